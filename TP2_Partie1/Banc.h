@@ -0,0 +1,232 @@
+/**
+ * \file Banc.h
+ * \brief Ce fichier contient les outils communs aux bancs d'essai du dictionnaire.
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ * Chaque banc d'essai (Banc*.cpp) a sa propre fonction main et se compile avec les sources du
+ * dictionnaire, sans Principal.cpp ni les autres bancs ou tests, par exemple:
+ *
+ *    g++ -std=c++17 -O2 -pthread BancPool.cpp $(ls *.cpp | grep -v -e Principal -e Banc -e Test)
+ */
+
+
+#ifndef BANC_H_
+#define BANC_H_
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace TP2P1
+{
+
+/*
+*\brief		Donne nb mots alatoires de 3  12 lettres minuscules (avec des doublons possibles)
+*
+*/
+inline std::vector<std::string> motsAleatoires(size_t nb, unsigned int graine)
+{
+	std::mt19937 generateur(graine);
+	std::vector<std::string> mots(nb);
+	for (size_t i = 0; i < nb; i++)
+	{
+		mots[i].resize(3 + generateur() % 10);
+		for (size_t j = 0; j < mots[i].size(); j++)
+			mots[i][j] = static_cast<char>('a' + generateur() % 26);
+	}
+	return mots;
+}
+
+/**
+* \class Chrono
+*
+* \brief Mesure le temps coul depuis sa construction
+*/
+class Chrono
+{
+public:
+
+	Chrono() : debut(std::chrono::steady_clock::now()) {}
+
+	/*
+	*\brief		Donne le temps coul, en millisecondes
+	*/
+	double ms() const
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - debut).count();
+	}
+
+private:
+
+   std::chrono::steady_clock::time_point debut;	// Le moment de la construction
+};
+
+/**
+* \class ArbreReference
+*
+* \brief L'arbre AVL d'origine du dictionnaire, gard comme point de comparaison
+*
+*  Chaque noeud est allou par new et contient son mot et ses traductions dans des std::string;
+*  les enfants sont des pointeurs. L'insertion et la destruction sont rcursives, comme dans la
+*  version d'origine de Dictionnaire.
+*/
+class ArbreReference
+{
+public:
+
+	ArbreReference() : racine(0), cpt(0) {}
+
+	~ArbreReference() { _auxDetruire(racine); }
+
+	/*
+	*\brief		Ajouter un mot et l'une de ses traductions
+	*/
+	void ajouteMot(const std::string &motOriginal, const std::string &motTraduit)
+	{
+		_auxInserer(racine, motOriginal, motTraduit);
+	}
+
+	/*
+	*\brief		Vrifier si le mot donn appartient  l'arbre
+	*/
+	bool appartient(const std::string &mot) const
+	{
+		return _chercher(mot) != 0;
+	}
+
+	/*
+	*\brief		Donne une copie des traductions d'un mot, ou un vecteur vide
+	*/
+	std::vector<std::string> traduit(const std::string &mot) const
+	{
+		const Noeud * noeud = _chercher(mot);
+		return noeud == 0 ? std::vector<std::string>() : noeud->traductions;
+	}
+
+	/*
+	*\brief		Donne le nombre de mots
+	*/
+	int taille() const { return cpt; }
+
+private:
+
+	struct Noeud
+	{
+		std::string mot;
+		std::vector<std::string> traductions;
+		Noeud * gauche;
+		Noeud * droite;
+		int hauteur;
+
+		Noeud(const std::string &motOriginal, const std::string &motTraduit)
+			: mot(motOriginal), gauche(0), droite(0), hauteur(0) { traductions.push_back(motTraduit); }
+	};
+
+   Noeud * racine;	// La racine de l'arbre
+
+   int cpt;		// Le nombre de mots
+
+   // L'arbre possde ses noeuds: il ne se copie pas
+   ArbreReference(const ArbreReference &);
+   ArbreReference & operator=(const ArbreReference &);
+
+   const Noeud * _chercher(const std::string &mot) const
+   {
+	   const Noeud * noeud = racine;
+	   while (noeud != 0)
+	   {
+		   int comparaison = noeud->mot.compare(mot);
+		   if (comparaison == 0)
+			   return noeud;
+		   noeud = comparaison > 0 ? noeud->gauche : noeud->droite;
+	   }
+	   return 0;
+   }
+
+   static int _hauteur(const Noeud * noeud) { return noeud == 0 ? -1 : noeud->hauteur; }
+
+   static void _majHauteur(Noeud * noeud)
+   {
+	   int g = _hauteur(noeud->gauche), d = _hauteur(noeud->droite);
+	   noeud->hauteur = 1 + (g > d ? g : d);
+   }
+
+   static void _zigZigGauche(Noeud * &k2)
+   {
+	   Noeud * k1 = k2->gauche;
+	   k2->gauche = k1->droite;
+	   k1->droite = k2;
+	   _majHauteur(k2);
+	   _majHauteur(k1);
+	   k2 = k1;
+   }
+
+   static void _zigZigDroit(Noeud * &k2)
+   {
+	   Noeud * k1 = k2->droite;
+	   k2->droite = k1->gauche;
+	   k1->gauche = k2;
+	   _majHauteur(k2);
+	   _majHauteur(k1);
+	   k2 = k1;
+   }
+
+   void _auxInserer(Noeud * &arbre, const std::string &motOriginal, const std::string &motTraduit)
+   {
+	   if (arbre == 0)
+	   {
+		   arbre = new Noeud(motOriginal, motTraduit);
+		   cpt++;
+		   return;
+	   }
+	   int comparaison = arbre->mot.compare(motOriginal);
+	   if (comparaison == 0)
+	   {
+		   arbre->traductions.push_back(motTraduit);
+		   return;
+	   }
+	   if (comparaison > 0)
+	   {
+		   _auxInserer(arbre->gauche, motOriginal, motTraduit);
+		   if (_hauteur(arbre->gauche) - _hauteur(arbre->droite) == 2)
+		   {
+			   if (arbre->gauche->mot.compare(motOriginal) <= 0)
+				   _zigZigDroit(arbre->gauche);
+			   _zigZigGauche(arbre);
+		   }
+		   else
+			   _majHauteur(arbre);
+	   }
+	   else
+	   {
+		   _auxInserer(arbre->droite, motOriginal, motTraduit);
+		   if (_hauteur(arbre->droite) - _hauteur(arbre->gauche) == 2)
+		   {
+			   if (arbre->droite->mot.compare(motOriginal) > 0)
+				   _zigZigGauche(arbre->droite);
+			   _zigZigDroit(arbre);
+		   }
+		   else
+			   _majHauteur(arbre);
+	   }
+   }
+
+   void _auxDetruire(Noeud * &arbre)
+   {
+	   if (arbre != 0)
+	   {
+		   _auxDetruire(arbre->gauche);
+		   _auxDetruire(arbre->droite);
+		   delete arbre;
+		   cpt--;
+		   arbre = 0;
+	   }
+   }
+};
+
+}
+
+#endif /* BANC_H_ */
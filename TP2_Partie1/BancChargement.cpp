@@ -0,0 +1,263 @@
+/**
+ * \file BancChargement.cpp
+ * \brief Banc d'essai: chargement du dictionnaire, ancien lecteur ifstream/strtok contre fichier projet
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ * Un fichier d'un million de lignes  mot<TAB>traduction[Noun]  est crit, puis charg trois
+ * fois par chaque lecteur, chaque fois dans un processus  part: le temps est celui du
+ * chargement seul, la mmoire est le pic de RSS du processus (getrusage, ru_maxrss), pages
+ * du fichier projet comprises. Les lecteurs compars:
+ *   - l'ancien: ifstream, getline() dans un tampon de 200 octets, strtok(), puis ajouteMot();
+ *   - mmap mot par mot: FichierMappe et le dcoupage sur place, chaque paire passe  ajouteMot(),
+ *     comme le constructeur au moment o la projection a t introduite;
+ *   - mmap: le constructeur Dictionnaire(const FichierMappe &) actuel, qui btit l'arbre d'un coup.
+ *
+ * La projection seule n'a rien gagn. Quand elle a t introduite (fichier de 29 Mo, 892776 mots
+ * distincts, mesur hors du dpt), aucun gain de temps et un pic de mmoire plus haut:
+ *      ancien ifstream/strtok   1193-1201 ms, pic 135 Mo
+ *      mmap mot par mot         1163-1196 ms, pic 164 Mo
+ * Avec ce banc, sur un coeur charg (fichier crit de 21 Mo, deux excutions), mme constat;
+ * l'ordre des deux premiers change d'une excution  l'autre:
+ *      ancien ifstream/strtok       5230-6335 ms, pic 110 Mo
+ *      mmap mot par mot             5566-5922 ms, pic 180 Mo
+ *      mmap, arbre bti d'un coup   2088-2443 ms, pic 168-169 Mo
+ * Le chargement est domin par les insertions dans l'arbre et l'index des corrections, pas par
+ * la lecture: le gain du dernier vient de la construction de l'arbre d'un coup, pas de mmap. Le
+ * surplus de RSS est celui des pages du fichier projet, comptes tant qu'il est projet: elles
+ * sont propres et rcuprables par le systme, mais elles comptent dans le pic.
+ *
+ *    g++ -std=c++17 -O2 -pthread BancChargement.cpp $(ls *.cpp | grep -v -e Principal -e Banc -e Test)
+ */
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Banc.h"
+#include "Dictionnaire.h"
+#include "FichierMappe.h"
+using namespace TP2P1;
+
+/**
+ * \fn void chargerAncien(Dictionnaire &dico, std::ifstream &fichier)
+ * \brief Le chargement d'origine de Dictionnaire, recopi tel quel.
+ *
+ * Seule diffrence: une ligne sans mot ou sans traduction est saute, alors que l'original
+ * construisait un std::string  partir d'un pointeur nul (la dernire ligne, vide).
+ */
+static void chargerAncien(Dictionnaire &dico, std::ifstream &fichier)
+{
+	char ligne[200];  /* pour contenir une ligne lu dans le fichier */
+	char *mot, *motTraduit; /* le mot dans la langue original et sa traduction */
+	char *ptr;              /* un pointeur de service */
+	int posT, posD; /* pour identifier la position d'un tilde ou d'un double-point(:) */
+	bool contexte;  /* indique la prsence d'un contexte entre () juste aprs le mot original */
+
+	while (!fichier.eof())
+	{
+		/* lecture d'une ligne */
+		fichier.getline(ligne, 199);
+
+		/* Ignorer les lignes d'en-tte */
+		if (ligne[0] == '#')
+		{
+			continue;
+		}
+
+		posT = 0;
+		posD = 0;
+
+		ptr = strchr(ligne, '~');
+		if (ptr != NULL)
+		{
+			posT = (ptr - ligne) / sizeof(char);
+		}
+
+		ptr = strchr(ligne, ':');
+		if (ptr != NULL)
+		{
+			posD = (ptr - ligne) / sizeof(char);
+		}
+
+		/* Vrifier s'il y a un contexte entre parenthses  */
+		/* tout de suite aprs le mot original              */
+		contexte = false;
+		ptr = strchr(ligne, '\t');
+		if (ptr != NULL)
+		{
+			if (*(ptr + 1) == '(')
+			{
+				contexte = true;
+			}
+		}
+
+		/* Aller chercher le mot original */
+		mot = strtok(ligne, "\t");
+
+		/* Passer le contexte s'il y a lieu */
+		if (contexte == true)
+		{
+			ptr = strtok(NULL, "()");
+		}
+
+		if (posD < posT)
+		{
+			motTraduit = strtok(NULL, ":");
+		}
+		else
+		{
+			if (posT < posD)
+			{
+				ptr = strtok(NULL, ":");
+				motTraduit = strtok(NULL, "([,;\n");
+			}
+			else
+			{
+				/* obtenir la traduction */
+				motTraduit = strtok(NULL, "([,;\n");
+			}
+		}
+
+		if (mot == NULL || motTraduit == NULL)
+		{
+			continue;
+		}
+
+		std::string sMotTraduit = motTraduit;
+		std::string sMot = mot;
+
+		dico.ajouteMot(sMot, sMotTraduit);
+	}
+}
+
+/**
+ * \fn void chargerMotParMot(Dictionnaire &dico, const FichierMappe &fichier)
+ * \brief Le fichier projet, dcoup sur place, chaque paire insre par ajouteMot().
+ */
+static void chargerMotParMot(Dictionnaire &dico, const FichierMappe &fichier)
+{
+	std::vector<Dictionnaire::Paire> paires;
+	Dictionnaire::analyserTexte(fichier.contenu(), paires);
+	for (size_t i = 0; i < paires.size(); i++)
+		dico.ajouteMot(std::string(paires[i].first), std::string(paires[i].second));
+}
+
+/**
+ * \fn void charger(int lecteur, const std::string &nomFichier)
+ * \brief Charge le fichier avec un lecteur, puis affiche le temps et le pic de mmoire du processus.
+ */
+static void charger(int lecteur, const std::string &nomFichier)
+{
+	//Le message  Chargement du dictionnaire...  du constructeur ne doit pas couper la ligne
+	std::ostringstream muet;
+	std::streambuf * sortie = std::cout.rdbuf(muet.rdbuf());
+	double ms = 0;
+	if (lecteur == 0)
+	{
+		Chrono chrono;
+		std::ifstream fichier(nomFichier);
+		Dictionnaire dico;
+		chargerAncien(dico, fichier);
+		ms = chrono.ms();
+	}
+	else if (lecteur == 1)
+	{
+		Chrono chrono;
+		FichierMappe fichier(nomFichier);
+		Dictionnaire dico;
+		chargerMotParMot(dico, fichier);
+		ms = chrono.ms();
+	}
+	else
+	{
+		Chrono chrono;
+		FichierMappe fichier(nomFichier);
+		Dictionnaire dico(fichier);
+		ms = chrono.ms();
+	}
+	std::cout.rdbuf(sortie);
+
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	std::cout << ms << " ms, pic " << usage.ru_maxrss / 1024 << " Mo" << std::endl;
+}
+
+/**
+ * \fn void dansUnProcessus(int lecteur, const std::string &nomFichier)
+ * \brief Excute charger() dans un processus fils, pour que chaque pic de mmoire soit mesur seul.
+ *
+ * Le fils hrite du pic du pre au moment du fork(): le pre ne garde donc jamais les mots en mmoire.
+ */
+static void dansUnProcessus(int lecteur, const std::string &nomFichier)
+{
+	std::cout.flush();
+	pid_t fils = fork();
+	if (fils == 0)
+	{
+		charger(lecteur, nomFichier);
+		std::cout.flush();
+		_exit(0);
+	}
+	int etat;
+	waitpid(fils, &etat, 0);
+}
+
+/**
+ * \fn void ecrireFichier(const std::string &nomFichier, size_t nbLignes)
+ * \brief crit nbLignes paires au hasard, dans un processus fils pour la mme raison.
+ */
+static void ecrireFichier(const std::string &nomFichier, size_t nbLignes)
+{
+	pid_t fils = fork();
+	if (fils == 0)
+	{
+		std::vector<std::string> mots = motsAleatoires(nbLignes, 2014);
+		std::vector<std::string> traductions = motsAleatoires(nbLignes, 2015);
+		std::ofstream fichier(nomFichier);
+		for (size_t i = 0; i < nbLignes; i++)
+			fichier << mots[i] << '\t' << traductions[i] << "[Noun]\n";
+		_exit(fichier ? 0 : 1);
+	}
+	int etat;
+	waitpid(fils, &etat, 0);
+}
+
+/**
+ * \fn int main(int argc, char *argv[])
+ * \brief Charge trois fois le fichier donn (ou un fichier d'un million de lignes crit pour l'occasion) avec chaque lecteur.
+ */
+int main(int argc, char *argv[])
+{
+	std::string nomFichier = argc > 1 ? argv[1] : "BancChargement.txt";
+	if (argc <= 1)
+		ecrireFichier(nomFichier, 1000000);
+
+	FichierMappe taille(nomFichier);
+	if (!taille.estOuvert())
+	{
+		std::cout << "Impossible d'ouvrir " << nomFichier << std::endl;
+		return 1;
+	}
+	std::cout << nomFichier << " : " << taille.contenu().size() / (1024 * 1024) << " Mo" << std::endl;
+
+	const char * noms[] = { "ancien ifstream/strtok", "mmap mot par mot", "mmap, arbre bti d'un coup" };
+	for (int lecteur = 0; lecteur < 3; lecteur++)
+		for (int essai = 0; essai < 3; essai++)
+		{
+			std::cout << "  " << noms[lecteur] << " : ";
+			dansUnProcessus(lecteur, nomFichier);
+		}
+
+	if (argc <= 1)
+		std::remove(nomFichier.c_str());
+	return 0;
+}
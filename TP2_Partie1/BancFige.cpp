@@ -0,0 +1,82 @@
+/**
+ * \file BancFige.cpp
+ * \brief Banc d'essai: recherches par seconde, DictionnaireFige contre l'arbre de pointeurs
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ * Les mmes mots sont chargs dans l'arbre de rfrence (noeuds allous par new), dans un
+ * Dictionnaire et dans sa copie fige, puis chacun rpond aux mmes requtes, moiti de mots
+ * prsents et moiti de mots absents, avec appartient() puis traduit().
+ *
+ *    g++ -std=c++17 -O2 -pthread BancFige.cpp $(ls *.cpp | grep -v -e Principal -e Banc -e Test)
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Banc.h"
+#include "Dictionnaire.h"
+#include "DictionnaireFige.h"
+using namespace TP2P1;
+
+/**
+ * \fn void mesurer(const std::string &nom, const Arbre &arbre, const std::vector<std::string> &requetes)
+ * \brief Affiche le meilleur dbit de trois essais, en millions de recherches par seconde.
+ */
+template <typename Arbre>
+static void mesurer(const std::string &nom, const Arbre &arbre, const std::vector<std::string> &requetes)
+{
+	double appartient = 0, traduit = 0;
+	size_t trouves = 0;
+	for (int essai = 0; essai < 3; essai++)
+	{
+		Chrono chrono;
+		for (size_t i = 0; i < requetes.size(); i++)
+			trouves += arbre.appartient(requetes[i]);
+		double debit = requetes.size() / chrono.ms() / 1000;
+		if (debit > appartient)
+			appartient = debit;
+
+		Chrono chronoTraduit;
+		for (size_t i = 0; i < requetes.size(); i++)
+			trouves += arbre.traduit(requetes[i]).size();
+		debit = requetes.size() / chronoTraduit.ms() / 1000;
+		if (debit > traduit)
+			traduit = debit;
+	}
+	std::cout << nom << " : appartient " << appartient << " M/s, traduit " << traduit << " M/s ("
+	          << trouves << " trouves)" << std::endl;
+}
+
+/**
+ * \fn int main()
+ * \brief Compare les trois structures sur 300 000 mots et 2 000 000 de requtes.
+ */
+int main()
+{
+	std::vector<std::string> mots = motsAleatoires(300000, 1);
+	std::vector<std::string> traductions = motsAleatoires(mots.size(), 2);
+	std::vector<std::string> absents = motsAleatoires(mots.size(), 3);
+
+	// Les requtes alternent un mot prsent et un mot (presque toujours) absent, au hasard
+	std::vector<std::string> requetes;
+	std::mt19937 generateur(4);
+	for (size_t i = 0; i < 2000000; i++)
+		requetes.push_back(i % 2 ? mots[generateur() % mots.size()] : absents[generateur() % absents.size()]);
+
+	ArbreReference reference;
+	Dictionnaire dico;
+	for (size_t i = 0; i < mots.size(); i++)
+	{
+		reference.ajouteMot(mots[i], traductions[i]);
+		dico.ajouteMot(mots[i], traductions[i]);
+	}
+	DictionnaireFige fige(dico);
+
+	mesurer("Arbre de pointeurs", reference, requetes);
+	mesurer("Dictionnaire", dico, requetes);
+	mesurer("DictionnaireFige", fige, requetes);
+	return 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * \file BancMemoire.cpp
+ * \brief Banc d'essai: octets de mmoire par paire, arbre de pointeurs contre Dictionnaire
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ * Les oprateurs new et delete de ce programme comptent les octets vivants du tas, en-ttes
+ * de malloc compris (malloc_usable_size + 8, comme les blocs de la glibc). Les mmes mots sont
+ * chargs dans l'arbre de rfrence (un noeud, un std::string et un vecteur de traductions
+ * allous par mot) et dans un Dictionnaire, mot par mot puis en un lot. L'index des corrections
+ * et la table des traductions sont aussi mesurs seuls, pour voir la part de chacun.
+ *
+ *    g++ -std=c++17 -O2 -pthread BancMemoire.cpp $(ls *.cpp | grep -v -e Principal -e Banc -e Test)
+ */
+
+#include <malloc.h>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "Banc.h"
+#include "Dictionnaire.h"
+#include "LotDictionnaire.h"
+#include "TableChaines.h"
+#include "TrieCorrections.h"
+using namespace TP2P1;
+
+static size_t octetsVivants = 0;	// Les octets du tas allous par new et pas encore librs
+
+void * operator new(size_t taille)
+{
+	void * bloc = std::malloc(taille == 0 ? 1 : taille);
+	if (bloc == 0)
+		throw std::bad_alloc();
+	octetsVivants += malloc_usable_size(bloc) + 8;
+	return bloc;
+}
+
+void operator delete(void * bloc) noexcept
+{
+	if (bloc == 0)
+		return;
+	octetsVivants -= malloc_usable_size(bloc) + 8;
+	std::free(bloc);
+}
+
+void operator delete(void * bloc, size_t) noexcept
+{
+	operator delete(bloc);
+}
+
+/**
+ * \fn void afficher(const std::string &nom, size_t avant, size_t nbMots)
+ * \brief Affiche les octets allous depuis avant, par paire charge.
+ */
+static void afficher(const std::string &nom, size_t avant, size_t nbMots)
+{
+	std::cout << "  " << nom << " : " << double(octetsVivants - avant) / nbMots << " octets/paire" << std::endl;
+}
+
+/**
+ * \fn void mesurer(const std::string &nom, const std::vector<std::string> &mots, const std::vector<std::string> &traductions)
+ * \brief Mesure chaque structure charge avec les mmes paires.
+ */
+static void mesurer(const std::string &nom, const std::vector<std::string> &mots, const std::vector<std::string> &traductions)
+{
+	std::cout << nom << " (" << mots.size() << " paires)" << std::endl;
+	{
+		size_t avant = octetsVivants;
+		ArbreReference reference;
+		for (size_t i = 0; i < mots.size(); i++)
+			reference.ajouteMot(mots[i], traductions[i]);
+		afficher("Arbre de pointeurs", avant, mots.size());
+	}
+	{
+		size_t avant = octetsVivants;
+		Dictionnaire dico;
+		for (size_t i = 0; i < mots.size(); i++)
+			dico.ajouteMot(mots[i], traductions[i]);
+		afficher("Dictionnaire, mot par mot", avant, mots.size());
+	}
+	{
+		std::string texte;
+		for (size_t i = 0; i < mots.size(); i++)
+			texte += mots[i] + '\t' + traductions[i] + '\n';
+		LotDictionnaire lot;
+		lot.ajouterTexte(texte);
+
+		size_t avant = octetsVivants;
+		Dictionnaire dico;
+		dico.fusionner(lot);
+		afficher("Dictionnaire, en un lot", avant, mots.size());
+	}
+	{
+		size_t avant = octetsVivants;
+		TrieCorrections index;
+		for (size_t i = 0; i < mots.size(); i++)
+			index.ajouter(mots[i]);
+		afficher("  dont l'index des corrections", avant, mots.size());
+	}
+	{
+		size_t avant = octetsVivants;
+		TableChaines chaines;
+		for (size_t i = 0; i < traductions.size(); i++)
+			chaines.interner(traductions[i]);
+		afficher("  dont la table des traductions", avant, mots.size());
+	}
+}
+
+/**
+ * \fn int main(int argc, char *argv[])
+ * \brief Mesure sur 400 000 mots alatoires, puis sur un fichier de dictionnaire.
+ */
+int main(int argc, char *argv[])
+{
+	std::vector<std::string> mots = motsAleatoires(400000, 1);
+	std::vector<std::string> traductions = motsAleatoires(mots.size(), 2);
+	mesurer("Mots aleatoires", mots, traductions);
+
+	std::ifstream fichier(argc > 1 ? argv[1] : "EnglishFrench.txt");
+	if (fichier)
+	{
+		std::string texte((std::istreambuf_iterator<char>(fichier)), std::istreambuf_iterator<char>());
+		std::vector<Dictionnaire::Paire> paires;
+		Dictionnaire::analyserTexte(texte, paires);
+
+		mots.clear();
+		traductions.clear();
+		for (size_t i = 0; i < paires.size(); i++)
+		{
+			mots.push_back(std::string(paires[i].first));
+			traductions.push_back(std::string(paires[i].second));
+		}
+		mesurer("Fichier", mots, traductions);
+	}
+	return 0;
+}
@@ -0,0 +1,131 @@
+/**
+ * \file BancPartage.cpp
+ * \brief Banc d'essai: recherches par seconde dans un DictionnairePartage selon le nombre de lecteurs
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ * Chaque thread lecteur fait le mme nombre de recherches (appartient, moiti de mots prsents),
+ * de 1 lecteur jusqu'au double du nombre de coeurs. Trois cas sont mesurs: DictionnairePartage
+ * seul, DictionnairePartage pendant qu'un crivain publie un lot de 100 mots toutes les 10 ms
+ * avec ajouteMots(), et un Dictionnaire protg par un std::shared_mutex comme point de
+ * comparaison. Le dbit affich est celui de tous les lecteurs ensemble.
+ *
+ *    g++ -std=c++17 -O2 -pthread BancPartage.cpp $(ls *.cpp | grep -v -e Principal -e Banc -e Test)
+ *
+ * Un nombre maximal de lecteurs peut tre donn en argument.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Banc.h"
+#include "Dictionnaire.h"
+#include "DictionnairePartage.h"
+using namespace TP2P1;
+
+static const size_t NB_RECHERCHES = 500000;	// Le nombre de recherches de chaque lecteur
+
+/**
+ * \fn double mesurer(unsigned int nbLecteurs, const std::vector<std::vector<std::string> > &requetes, Recherche recherche)
+ * \brief Lance les lecteurs et donne leur dbit total, en millions de recherches par seconde.
+ */
+template <typename Recherche>
+static double mesurer(unsigned int nbLecteurs, const std::vector<std::vector<std::string> > &requetes, Recherche recherche)
+{
+	std::atomic<size_t> trouves(0);
+	std::vector<std::thread> lecteurs;
+	Chrono chrono;
+	for (unsigned int t = 0; t < nbLecteurs; t++)
+	{
+		lecteurs.push_back(std::thread([&, t]()
+		{
+			size_t n = 0;
+			for (size_t i = 0; i < requetes[t].size(); i++)
+				n += recherche(requetes[t][i]);
+			trouves += n;
+		}));
+	}
+	for (size_t t = 0; t < lecteurs.size(); t++)
+		lecteurs[t].join();
+	return nbLecteurs * NB_RECHERCHES / chrono.ms() / 1000;
+}
+
+/**
+ * \fn int main(int argc, char **argv)
+ * \brief Affiche le dbit des lecteurs pour 1, 2, 4, ... threads, dans les trois cas.
+ */
+int main(int argc, char **argv)
+{
+	unsigned int coeurs = std::thread::hardware_concurrency();
+	unsigned int nbMax = argc > 1 ? std::atoi(argv[1]) : (coeurs > 4 ? 2 * coeurs : 8);
+
+	std::vector<std::string> mots = motsAleatoires(300000, 1);
+	std::vector<std::string> traductions = motsAleatoires(mots.size(), 2);
+	std::vector<std::pair<std::string, std::string> > paires;
+	for (size_t i = 0; i < mots.size(); i++)
+		paires.push_back(std::make_pair(mots[i], traductions[i]));
+
+	DictionnairePartage partage;
+	partage.ajouteMots(paires);
+	Dictionnaire dico;
+	for (size_t i = 0; i < paires.size(); i++)
+		dico.ajouteMot(paires[i].first, paires[i].second);
+	std::shared_mutex verrou;
+
+	// Chaque lecteur a ses propres requtes: un mot prsent, puis un mot (presque toujours) absent
+	std::vector<std::vector<std::string> > requetes(nbMax);
+	for (unsigned int t = 0; t < nbMax; t++)
+	{
+		std::vector<std::string> absents = motsAleatoires(NB_RECHERCHES / 2, 100 + t);
+		std::mt19937 generateur(t);
+		for (size_t i = 0; i < NB_RECHERCHES; i++)
+			requetes[t].push_back(i % 2 ? absents[i / 2] : mots[generateur() % mots.size()]);
+	}
+
+	// Un premier passage, non affich, pour que les mesures ne commencent pas  froid
+	mesurer(1, requetes, [&](const std::string &mot) { return partage.appartient(mot); });
+
+	std::cout << mots.size() << " mots, " << coeurs << " coeur(s), " << NB_RECHERCHES << " recherches par lecteur" << std::endl;
+	for (unsigned int nb = 1; nb <= nbMax; nb *= 2)
+	{
+		double seul = mesurer(nb, requetes, [&](const std::string &mot) { return partage.appartient(mot); });
+
+		// Un crivain publie des lots pendant toute la mesure
+		std::atomic<bool> fini(false);
+		std::thread ecrivain([&]()
+		{
+			for (unsigned int graine = 1000; !fini; graine++)
+			{
+				std::vector<std::string> nouveaux = motsAleatoires(100, graine);
+				std::vector<std::pair<std::string, std::string> > lot;
+				for (size_t i = 0; i < nouveaux.size(); i++)
+					lot.push_back(std::make_pair(nouveaux[i], nouveaux[i]));
+				partage.ajouteMots(lot);
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+		});
+		uint64_t versionsAvant = partage.nbVersions();
+		double avecEcrivain = mesurer(nb, requetes, [&](const std::string &mot) { return partage.appartient(mot); });
+		fini = true;
+		ecrivain.join();
+		uint64_t publications = partage.nbVersions() - versionsAvant;
+
+		double verrouille = mesurer(nb, requetes, [&](const std::string &mot)
+		{
+			std::shared_lock<std::shared_mutex> lecture(verrou);
+			return dico.appartient(mot);
+		});
+
+		std::cout << nb << " lecteur(s) : partage " << seul << " M/s, partage + ecrivain " << avecEcrivain
+		          << " M/s (" << publications << " publications), shared_mutex " << verrouille << " M/s" << std::endl;
+	}
+	return 0;
+}
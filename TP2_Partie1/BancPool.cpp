@@ -0,0 +1,89 @@
+/**
+ * \file BancPool.cpp
+ * \brief Banc d'essai: chargement et destruction du dictionnaire, pool de noeuds contre new/delete
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ * Insre les mmes paires (mot, traduction) dans un Dictionnaire, dont les noeuds viennent de son
+ * pool, puis dans l'arbre de rfrence, qui alloue chaque noeud par new, et dtruit chacun des deux.
+ * Le Dictionnaire tient aussi  jour son index de correction et sa table de traductions.
+ *
+ *    g++ -std=c++17 -O2 -pthread BancPool.cpp $(ls *.cpp | grep -v -e Principal -e Banc -e Test)
+ *    ./a.out [fichier de dictionnaire]
+ */
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "Banc.h"
+#include "Dictionnaire.h"
+using namespace TP2P1;
+
+/**
+ * \fn double chargerDetruire(const std::vector<std::string> &mots, const std::vector<std::string> &traductions)
+ * \brief Temps d'insertion de toutes les paires puis de destruction, en millisecondes.
+ */
+template <typename Arbre>
+static double chargerDetruire(const std::vector<std::string> &mots, const std::vector<std::string> &traductions)
+{
+	Chrono chrono;
+	{
+		Arbre arbre;
+		for (size_t i = 0; i < mots.size(); i++)
+			arbre.ajouteMot(mots[i], traductions[i]);
+	}
+	return chrono.ms();
+}
+
+/**
+ * \fn void comparer(const std::string &nom, const std::vector<std::string> &mots, const std::vector<std::string> &traductions)
+ * \brief Affiche le meilleur de cinq essais pour chaque arbre.
+ */
+static void comparer(const std::string &nom, const std::vector<std::string> &mots, const std::vector<std::string> &traductions)
+{
+	double pool = 1e300, reference = 1e300;
+	for (int essai = 0; essai < 5; essai++)
+	{
+		double t = chargerDetruire<Dictionnaire>(mots, traductions);
+		if (t < pool)
+			pool = t;
+		t = chargerDetruire<ArbreReference>(mots, traductions);
+		if (t < reference)
+			reference = t;
+	}
+	std::cout << nom << " (" << mots.size() << " paires) : new/delete " << reference << " ms, pool "
+	          << pool << " ms" << std::endl;
+}
+
+/**
+ * \fn int main(int argc, char *argv[])
+ * \brief Compare les deux arbres sur des mots alatoires, puis sur un fichier de dictionnaire.
+ */
+int main(int argc, char *argv[])
+{
+	std::vector<std::string> mots = motsAleatoires(200000, 1);
+	std::vector<std::string> traductions = motsAleatoires(mots.size(), 2);
+	comparer("Mots aleatoires", mots, traductions);
+
+	std::ifstream fichier(argc > 1 ? argv[1] : "EnglishFrench.txt");
+	if (fichier)
+	{
+		std::string texte((std::istreambuf_iterator<char>(fichier)), std::istreambuf_iterator<char>());
+		std::vector<Dictionnaire::Paire> paires;
+		Dictionnaire::analyserTexte(texte, paires);
+
+		mots.clear();
+		traductions.clear();
+		for (size_t i = 0; i < paires.size(); i++)
+		{
+			mots.push_back(std::string(paires[i].first));
+			traductions.push_back(std::string(paires[i].second));
+		}
+		comparer("Fichier", mots, traductions);
+	}
+	return 0;
+}
@@ -0,0 +1,78 @@
+/**
+ * \file BancSimilitude.cpp
+ * \brief Banc d'essai: candidats nots par seconde, mot par mot et par lots (SSE2, AVX2)
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ * Note les mmes candidats contre quelques requtes avec Dictionnaire::similitude(), un mot  la
+ * fois, puis avec LotSimilitude par lots de 256, pour chaque jeu d'instructions que le processeur
+ * supporte. Les scores des lots sont aussi compars  ceux de similitude().
+ *
+ *    g++ -std=c++17 -O2 -pthread BancSimilitude.cpp $(ls *.cpp | grep -v -e Principal -e Banc -e Test)
+ */
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Banc.h"
+#include "Dictionnaire.h"
+#include "LotSimilitude.h"
+using namespace TP2P1;
+
+static const size_t TAILLE_LOT = 256;	// Comme le parcours complet de suggereCorrections()
+
+/**
+ * \fn int main()
+ * \brief Affiche le dbit de chaque calcul, en millions de candidats par seconde.
+ */
+int main()
+{
+	std::vector<std::string> mots = motsAleatoires(300000, 1);
+	std::vector<std::string_view> candidats(mots.begin(), mots.end());
+	const std::string requetes[] = { "hous", "wather", "aple", "translation", "incomprehensible" };
+	const size_t nbRequetes = sizeof(requetes) / sizeof(requetes[0]);
+
+	Dictionnaire dico;
+	std::vector<double> attendus(candidats.size() * nbRequetes);
+	Chrono chrono;
+	for (size_t r = 0; r < nbRequetes; r++)
+		for (size_t i = 0; i < candidats.size(); i++)
+			attendus[r * candidats.size() + i] = dico.similitude(candidats[i], std::string_view(requetes[r]));
+	std::cout << "similitude(), un mot a la fois : " << attendus.size() / chrono.ms() / 1000 << " M/s" << std::endl;
+
+	const char * noms[] = { "SCALAIRE", "SSE2", "AVX2" };
+	LotSimilitude::JeuInstructions meilleur = LotSimilitude::jeuInstructions();
+	std::vector<double> scores(candidats.size());
+	for (int jeu = LotSimilitude::SCALAIRE; jeu <= meilleur; jeu++)
+	{
+		LotSimilitude::choisirJeuInstructions(static_cast<LotSimilitude::JeuInstructions>(jeu));
+		size_t differences = 0;
+		double meilleurTemps = 1e300;
+		for (int essai = 0; essai < 3; essai++)
+		{
+			double temps = 0;
+			for (size_t r = 0; r < nbRequetes; r++)
+			{
+				Chrono chronoLot;
+				LotSimilitude lot(requetes[r]);
+				for (size_t debut = 0; debut < candidats.size(); debut += TAILLE_LOT)
+				{
+					size_t nb = candidats.size() - debut < TAILLE_LOT ? candidats.size() - debut : TAILLE_LOT;
+					lot.noter(&candidats[debut], nb, &scores[debut]);
+				}
+				temps += chronoLot.ms();
+
+				for (size_t i = 0; i < candidats.size(); i++)
+					differences += scores[i] != attendus[r * candidats.size() + i];
+			}
+			if (temps < meilleurTemps)
+				meilleurTemps = temps;
+		}
+		std::cout << "LotSimilitude " << noms[jeu] << " : " << attendus.size() / meilleurTemps / 1000 << " M/s, "
+		          << differences << " scores differents" << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * \file BancThreads.cpp
+ * \brief Banc d'essai: parcours complet de suggereCorrections() selon le nombre de threads
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ * Un Dictionnaire de plus d'un million de mots alatoires distincts reoit des requtes de 16 lettres, trop
+ * loin de tous les mots pour que l'index en trouve un: chaque requte passe donc par le
+ * parcours complet. On mesure ce parcours de 1 thread jusqu'au double du nombre de coeurs
+ * et on vrifie que les corrections ne dpendent pas du nombre de threads.
+ *
+ *    g++ -std=c++17 -O2 -pthread BancThreads.cpp $(ls *.cpp | grep -v -e Principal -e Banc -e Test)
+ *
+ * Un nombre maximal de threads peut tre donn en argument.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Banc.h"
+#include "Dictionnaire.h"
+#include "DictionnaireFige.h"
+#include "LotDictionnaire.h"
+using namespace TP2P1;
+
+/**
+ * \fn int main(int argc, char **argv)
+ * \brief Affiche le temps moyen d'une requte pour 1, 2, 4, ... threads.
+ */
+int main(int argc, char **argv)
+{
+	unsigned int coeurs = std::thread::hardware_concurrency();
+	unsigned int nbMax = argc > 1 ? std::atoi(argv[1]) : (coeurs > 4 ? 2 * coeurs : 8);
+
+	std::vector<std::string> mots = motsAleatoires(1200000, 1);
+	std::vector<std::string> traductions = motsAleatoires(mots.size(), 2);
+	std::string texte;
+	for (size_t i = 0; i < mots.size(); i++)
+		texte += mots[i] + '\t' + traductions[i] + '\n';
+	LotDictionnaire lot;
+	lot.ajouterTexte(texte);
+	Dictionnaire dico;
+	dico.fusionner(lot);
+	std::cout << DictionnaireFige(dico).taille() << " mots distincts, " << coeurs << " coeur(s)" << std::endl;
+
+	// Le cache des corrections est dsactiv par dfaut: chaque requte refait le parcours
+	std::vector<std::string> requetes = motsAleatoires(5, 100);
+	for (size_t i = 0; i < requetes.size(); i++)
+		requetes[i] += std::string(16 - requetes[i].size(), 'q');
+
+	std::vector<std::string> reference;
+	for (unsigned int nb = 1; nb <= nbMax; nb *= 2)
+	{
+		dico.fixerNbThreads(nb);
+
+		std::vector<std::string> corrections;
+		Chrono chrono;
+		for (size_t i = 0; i < requetes.size(); i++)
+		{
+			std::vector<std::string> resultat = dico.suggereCorrections(requetes[i]);
+			corrections.insert(corrections.end(), resultat.begin(), resultat.end());
+		}
+		double ms = chrono.ms() / requetes.size();
+		std::cout << nb << " thread(s) : " << ms << " ms/requete";
+		if (nb == 1)
+			reference = corrections;
+		else if (corrections != reference)
+			std::cout << " (corrections DIFFERENTES de 1 thread)";
+		std::cout << std::endl;
+	}
+	return 0;
+}
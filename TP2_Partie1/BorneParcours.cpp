@@ -0,0 +1,59 @@
+/**
+ * \file BorneParcours.cpp
+ * \brief Ce fichier contient une implantation des mthodes de la classe BorneParcours
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+#include "BorneParcours.h"
+#include <cstdint>
+namespace TP2P1
+{
+
+	/**
+	 * \fn BorneParcours::BorneParcours(std::string_view borne, bool estPrefixe, size_t limite)
+	 * \param[in] borne : Le prfixe, ou la borne suprieure
+	 * \param[in] estPrefixe : Vrai si borne est un prfixe
+	 * \param[in] limite : Le nombre maximal de mots
+	 */
+	BorneParcours::BorneParcours(std::string_view borne, bool estPrefixe, size_t limite)
+		: borne(borne), estPrefixe(estPrefixe), restants(limite)
+	{
+	}
+
+	/**
+	 * \fn BorneParcours BorneParcours::prefixe(std::string_view prefixe, size_t limite)
+	 * \param[in] prefixe : Le dbut commun des mots
+	 * \param[in] limite : Le nombre maximal de mots
+	 */
+	BorneParcours BorneParcours::prefixe(std::string_view prefixe, size_t limite)
+	{
+		return BorneParcours(prefixe, true, limite);
+	}
+
+	/**
+	 * \fn BorneParcours BorneParcours::superieure(std::string_view fin)
+	 * \param[in] fin : Le premier mot exclu
+	 */
+	BorneParcours BorneParcours::superieure(std::string_view fin)
+	{
+		return BorneParcours(fin, false, SIZE_MAX);
+	}
+
+	/**
+	 * \fn bool BorneParcours::accepte(std::string_view mot)
+	 * \param[in] mot : Le mot suivant du parcours
+	 */
+	bool BorneParcours::accepte(std::string_view mot)
+	{
+		if (restants == 0)
+			return false;
+
+		bool dedans = estPrefixe ? mot.compare(0, borne.size(), borne) == 0 : mot < borne;
+		if (dedans)
+			restants--;
+		return dedans;
+	}
+
+}
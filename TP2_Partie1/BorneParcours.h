@@ -0,0 +1,69 @@
+/**
+ * \file BorneParcours.h
+ * \brief Ce fichier contient la condition d'arrt d'un parcours des mots en ordre.
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+
+
+#ifndef BORNE_PARCOURS_H_
+#define BORNE_PARCOURS_H_
+
+#include <string>
+#include <string_view>
+
+namespace TP2P1
+{
+/**
+* \class BorneParcours
+*
+* \brief Dit si un parcours des mots en ordre doit continuer
+*
+*  Le parcours s'arrte au premier mot qui ne commence plus par un prfixe, ou au premier mot
+*  qui atteint une borne suprieure (exclue), et au plus tard aprs un nombre maximal de mots.
+*  Comme les mots arrivent en ordre, le premier mot refus termine le parcours.
+*/
+class BorneParcours
+{
+public:
+
+	/*
+	*\brief		Constructeur d'une borne sur un prfixe
+	*
+	*\post		Les mots accepts commencent par prefixe; il y en a au plus limite
+	*
+	*/
+	static BorneParcours prefixe(std::string_view prefixe, size_t limite);
+
+	/*
+	*\brief		Constructeur d'une borne suprieure
+	*
+	*\post		Les mots accepts sont strictement infrieurs  fin
+	*
+	*/
+	static BorneParcours superieure(std::string_view fin);
+
+	/*
+	*\brief		Vrifier le mot suivant du parcours
+	*
+	*\post		On retourne true si le mot fait partie du parcours; il compte alors dans la limite
+	*
+	*/
+	bool accepte(std::string_view mot);
+
+private:
+
+   BorneParcours(std::string_view borne, bool estPrefixe, size_t limite);
+
+   std::string borne;		// Le prfixe, ou la borne suprieure
+
+   bool estPrefixe;			// Vrai si borne est un prfixe
+
+   size_t restants;			// Le nombre de mots que le parcours peut encore donner
+};
+
+}
+
+#endif /* BORNE_PARCOURS_H_ */
@@ -0,0 +1,136 @@
+/**
+ * \file CacheCorrections.cpp
+ * \brief Ce fichier contient une implantation des mthodes de la classe CacheCorrections
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+#include "CacheCorrections.h"
+namespace TP2P1
+{
+
+	/**
+	 * \fn CacheCorrections::CacheCorrections(size_t capacite)
+	 * \param[in] capacite : Le nombre maximal d'entres (0 dsactive le cache)
+	 */
+	CacheCorrections::CacheCorrections(size_t capacite) : capacite(capacite), succes(0), echecs(0)
+	{
+	}
+
+	/**
+	 * \fn const std::vector<std::string> * CacheCorrections::chercher(std::string_view mot, unsigned int nbCorrections, double seuil)
+	 * \param[in] mot : Le mot mal crit
+	 * \param[in] nbCorrections : Le nombre de corrections demandes
+	 * \param[in] seuil : La similitude  dpasser
+	 *
+	 * Une entre calcule avec d'autres paramtres compte comme un chec.
+	 */
+	const std::vector<std::string> * CacheCorrections::chercher(std::string_view mot, unsigned int nbCorrections, double seuil)
+	{
+		if (capacite == 0)
+			return 0;
+
+		std::unordered_map<std::string_view, std::list<Entree>::iterator>::const_iterator trouve = index.find(mot);
+		if (trouve == index.end() || trouve->second->nbCorrections != nbCorrections || trouve->second->seuil != seuil)
+		{
+			echecs++;
+			return 0;
+		}
+
+		succes++;
+		entrees.splice(entrees.begin(), entrees, trouve->second);
+		return &entrees.front().corrections;
+	}
+
+	/**
+	 * \fn void CacheCorrections::garder(std::string_view mot, unsigned int nbCorrections, double seuil, const std::vector<std::string> &corrections)
+	 * \param[in] mot : Le mot mal crit
+	 * \param[in] nbCorrections : Le nombre de corrections demandes
+	 * \param[in] seuil : La similitude  dpasser
+	 * \param[in] corrections : Les corrections suggres
+	 */
+	void CacheCorrections::garder(std::string_view mot, unsigned int nbCorrections, double seuil,
+	                              const std::vector<std::string> &corrections)
+	{
+		if (capacite == 0)
+			return;
+
+		//Une entre du mme mot, calcule avec d'autres paramtres, est remplace
+		std::unordered_map<std::string_view, std::list<Entree>::iterator>::iterator trouve = index.find(mot);
+		if (trouve != index.end())
+		{
+			std::list<Entree>::iterator ancienne = trouve->second;
+			index.erase(trouve);
+			entrees.erase(ancienne);
+		}
+
+		//L'entre est construite  part: si une allocation choue, le cache n'a pas chang
+		std::list<Entree> nouvelle(1);
+		nouvelle.front().mot = mot;
+		nouvelle.front().nbCorrections = nbCorrections;
+		nouvelle.front().seuil = seuil;
+		nouvelle.front().corrections = corrections;
+		index.emplace(nouvelle.front().mot, nouvelle.begin());
+		entrees.splice(entrees.begin(), nouvelle);
+
+		_reduire(capacite);
+	}
+
+	/**
+	 * \fn void CacheCorrections::vider()
+	 */
+	void CacheCorrections::vider()
+	{
+		index.clear();
+		entrees.clear();
+	}
+
+	/**
+	 * \fn void CacheCorrections::fixerCapacite(size_t capacite)
+	 * \param[in] capacite : Le nombre maximal d'entres (0 dsactive le cache)
+	 */
+	void CacheCorrections::fixerCapacite(size_t capacite)
+	{
+		this->capacite = capacite;
+		_reduire(capacite);
+	}
+
+	/**
+	 * \fn unsigned long long CacheCorrections::nbSucces() const
+	 */
+	unsigned long long CacheCorrections::nbSucces() const
+	{
+		return succes;
+	}
+
+	/**
+	 * \fn unsigned long long CacheCorrections::nbEchecs() const
+	 */
+	unsigned long long CacheCorrections::nbEchecs() const
+	{
+		return echecs;
+	}
+
+	/**
+	 * \fn size_t CacheCorrections::taille() const
+	 */
+	size_t CacheCorrections::taille() const
+	{
+		return entrees.size();
+	}
+
+	/**
+	 * \fn void CacheCorrections::_reduire(size_t nb)
+	 * \param[in] nb : Le nombre d'entres  garder au plus
+	 */
+	void CacheCorrections::_reduire(size_t nb)
+	{
+		while (entrees.size() > nb)
+		{
+			index.erase(entrees.back().mot);
+			entrees.pop_back();
+		}
+	}
+
+}
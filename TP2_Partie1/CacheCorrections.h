@@ -0,0 +1,127 @@
+/**
+ * \file CacheCorrections.h
+ * \brief Ce fichier contient l'interface d'un cache LRU des corrections dj suggres.
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+
+
+#ifndef CACHE_CORRECTIONS_H_
+#define CACHE_CORRECTIONS_H_
+
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace TP2P1
+{
+/**
+* \class CacheCorrections
+*
+* \brief Garde les corrections des derniers mots mal crits, jusqu' une capacit fixe
+*
+*  Les entres sont dans une liste, de la plus rcemment utilise  la plus ancienne; une table
+*  de hachage donne l'entre d'un mot en O(1). Quand le cache est plein, l'entre la plus
+*  ancienne est retire. Une capacit de 0 dsactive le cache.
+*/
+class CacheCorrections
+{
+public:
+
+	/*
+	*\brief		Constructeur
+	*
+	*\post		Un cache vide, de capacit capacite, a t initialis
+	*
+	*/
+	explicit CacheCorrections(size_t capacite = 0);
+
+	/*
+	*\brief		Chercher les corrections d'un mot, calcules avec les mmes paramtres
+	*
+	*\post		Si le mot est trouv, son entre devient la plus rcente et on retourne ses corrections.
+	*\post		Sinon, on retourne 0. Le compte des succs ou des checs est augment
+	*
+	*/
+	const std::vector<std::string> * chercher(std::string_view mot, unsigned int nbCorrections, double seuil);
+
+	/*
+	*\brief		Garder les corrections d'un mot
+	*
+	*\post		L'entre du mot est la plus rcente; la plus ancienne est retire si le cache tait plein
+	*
+	*\exception	bad_alloc s'il n'y a pas assez de mmoire; le cache reste alors valide
+	*
+	*/
+	void garder(std::string_view mot, unsigned int nbCorrections, double seuil,
+	            const std::vector<std::string> &corrections);
+
+	/*
+	*\brief		Oublier toutes les corrections, par exemple aprs une modification du dictionnaire
+	*
+	*\post		Le cache est vide; la capacit et les comptes sont inchangs
+	*
+	*/
+	void vider();
+
+	/*
+	*\brief		Changer la capacit
+	*
+	*\post		Les entres les plus anciennes en trop sont retires
+	*
+	*/
+	void fixerCapacite(size_t capacite);
+
+	/*
+	*\brief		Donne le nombre de recherches qui ont trouv leur mot
+	*
+	*/
+	unsigned long long nbSucces() const;
+
+	/*
+	*\brief		Donne le nombre de recherches qui n'ont pas trouv leur mot
+	*
+	*/
+	unsigned long long nbEchecs() const;
+
+	/*
+	*\brief		Donne le nombre d'entres
+	*
+	*/
+	size_t taille() const;
+
+private:
+
+   struct Entree
+   {
+	   std::string mot;						// Le mot mal crit
+
+	   unsigned int nbCorrections;			// Les paramtres du calcul
+	   double seuil;
+
+	   std::vector<std::string> corrections;	// Le rsultat de suggereCorrections()
+   };
+
+   std::list<Entree> entrees;		// Les entres, de la plus rcente  la plus ancienne
+
+   std::unordered_map<std::string_view, std::list<Entree>::iterator> index;	// L'entre de chaque mot; la cl pointe dans Entree::mot
+
+   size_t capacite;				// Le nombre maximal d'entres
+
+   unsigned long long succes;		// Le nombre de recherches russies
+
+   unsigned long long echecs;		// Le nombre de recherches manques
+
+   /*
+	*\brief		Retirer les entres les plus anciennes jusqu' en avoir au plus nb
+	*/
+   void _reduire(size_t nb);
+};
+
+}
+
+#endif /* CACHE_CORRECTIONS_H_ */
@@ -6,9 +6,15 @@
  * \date juillet 2014
  *
  */
-#define _CRT_SECURE_NO_WARNINGS
 #include "Dictionnaire.h"
-#include <string.h>
+#include "TraducteurTexte.h"
+#include "LotDictionnaire.h"
+#include <new>
+#include <algorithm>
+#include <iterator>
+#include <atomic>
+#include <future>
+#include <thread>
 namespace TP2P1
 {
 
@@ -19,6 +25,8 @@ namespace TP2P1
 	{
 		racine = 0; 
 		cpt=0;
+		nbThreads = 1;
+		listesPerdues = 0;
 	}
 
 	/**
@@ -29,10 +37,27 @@ namespace TP2P1
 	{
 		racine = 0; 
 		cpt=0;
+		nbThreads = 1;
+		listesPerdues = 0;
 
 		chargerDictionnaire(fichier);
 	}
 
+	/**
+	 * \fn  Dictionnaire::Dictionnaire(const FichierMappe &fichier)
+	 * \param[in] fichier : Fichier projet en mmoire
+	 */
+	Dictionnaire::Dictionnaire(const FichierMappe &fichier)
+	{
+		racine = 0; 
+		cpt=0;
+		nbThreads = 1;
+		listesPerdues = 0;
+
+		if (fichier.estOuvert())
+			chargerTexte(fichier.contenu());
+	}
+
 	/**
 	 * \fn  Dictionnaire::~Dictionnaire(std::ifstream &fichier)
 	 */
@@ -48,7 +73,12 @@ namespace TP2P1
 	 */
 	void Dictionnaire::ajouteMot(const std ::string& motOriginal, const std ::string& motTraduit)
 	{
+		int avant = cpt;
 		_auxInserer(racine, motOriginal,motTraduit);
+
+		//Une nouvelle traduction ne change pas les corrections; un nouveau mot, oui
+		if (cpt != avant)
+			cacheCorrections.vider();
 	}
 
 	/**
@@ -64,139 +94,470 @@ namespace TP2P1
 			throw std::logic_error("enlever: Le mot ne fait pas partie du dictionnaire\n");
 
 		_auxEnlever(racine, motOriginal);
+		index.retirer(motOriginal);
+		cacheCorrections.vider();
 	}
 
 
 	/**
-	 * \fn bool  Dictionnaire::appartient(const std::string &mot)
+	 * \fn void Dictionnaire::fusionner(const LotDictionnaire &lot)
+	 * \param[in] lot : Les paires (mot, traduction)  ajouter, tries par mot
+	 */
+	void Dictionnaire::fusionner(const LotDictionnaire &lot)
+	{
+		const std::vector<Paire> &paires = lot.paires();
+		if (paires.empty())
+			return;
+
+		//Vrifier tout le lot avant de toucher  l'arbre, quel que soit le chemin pris ensuite
+		size_t nouveaux = _verifierLot(paires);
+
+		if (racine == 0)
+		{
+			std::vector<Paire> copie(paires);
+			_construireEquilibre(copie);
+		}
+		else if (paires.size() < static_cast<size_t>(cpt) / RAPPORT_FUSION)
+		{
+			//Peu de mots: k insertions en O(log n) cotent moins qu'un parcours de tout l'arbre
+			for (size_t i = 0; i < paires.size(); i++)
+				_auxInserer(racine, paires[i].first, paires[i].second);
+		}
+		else
+			_fusionnerTrie(paires, nouveaux);
+
+		cacheCorrections.vider();
+
+		//Les intervalles recopis pour les mots dj prsents sont rcuprs comme aprs un retrait
+		if (2 * listesPerdues > listes.size())
+		{
+			try
+			{
+				_compacterListes();
+			}
+			catch (const std::bad_alloc &)
+			{
+			}
+		}
+	}
+
+	/**
+	 * \fn bool  Dictionnaire::appartient(const std::string &mot) const
 	 * \param[in] motOriginal : Mot  vrifier
 	 */
-	bool Dictionnaire::appartient(const std::string &mot)
+	bool Dictionnaire::appartient(const std::string &mot) const
 	{
 		return _auxAppartient(racine, mot)!=0;
 	}
 
 	/**
-	 * \fn std::vector<std::string> Dictionnaire::suggereCorrections(const std::string& motMalEcrit)
+	 * \fn std::vector<std::string> Dictionnaire::suggereCorrections(const std::string& motMalEcrit, unsigned int nbCorrections, double seuil)
 	 * \param[in] motMalEcrit : Mot  corriger
+	 * \param[in] nbCorrections : Nombre maximal de corrections
+	 * \param[in] seuil : Similitude  dpasser lors du parcours complet
 	 */
-	std::vector<std::string> Dictionnaire::suggereCorrections(const std::string& motMalEcrit)
+	std::vector<std::string> Dictionnaire::suggereCorrections(const std::string& motMalEcrit, unsigned int nbCorrections, double seuil)
 	{
-		//On met une sensibilit de correction minimale.
-		double min = .4;
+		if (nbCorrections == 0)
+			return std::vector<std::string>();
+
+		const std::vector<std::string> * dejaCorrige = cacheCorrections.chercher(motMalEcrit, nbCorrections, seuil);
+		if (dejaCorrige != 0)
+			return *dejaCorrige;
+
 		std::vector<std::string> corrections;
-		_auxsuggereCorrections(racine, motMalEcrit,min,corrections);
+
+		//On largit la recherche dans l'index jusqu' avoir assez de mots proches
+		std::vector<std::pair<unsigned int, std::string> > proches;
+		for (unsigned int distance = 1; distance <= DISTANCE_MAX && proches.size() < nbCorrections; distance++)
+			index.motsProches(motMalEcrit, distance, proches);
+
+		if (proches.empty())
+		{
+			//Rien d'assez proche dans l'index: on compare avec tous les mots.
+			MeilleursCandidats meilleurs(nbCorrections, seuil);
+			unsigned int nb = nbThreads != 0 ? nbThreads : std::thread::hardware_concurrency();
+			if (nb > 1 && cpt >= TAILLE_MIN_PARALLELE)
+				_suggereCorrectionsParallele(motMalEcrit, nb, meilleurs);
+			else
+				_auxsuggereCorrections(racine, motMalEcrit, meilleurs);
+			corrections = meilleurs.resultats();
+			cacheCorrections.garder(motMalEcrit, nbCorrections, seuil, corrections);
+			return corrections;
+		}
+
+		std::vector<std::string_view> mots(proches.size());
+		std::vector<double> scores(proches.size());
+		for (size_t i = 0; i < proches.size(); i++)
+			mots[i] = proches[i].second;
+		LotSimilitude(motMalEcrit).noter(&mots[0], mots.size(), &scores[0]);
+
+		//Les plus proches d'abord;  distance gale le plus similaire, puis l'ordre alphabtique
+		std::vector<std::pair<std::pair<unsigned int, double>, std::string> > classement;
+		classement.reserve(proches.size());
+		for (size_t i = 0; i < proches.size(); i++)
+			classement.push_back(std::make_pair(std::make_pair(proches[i].first, -scores[i]), proches[i].second));
+		std::sort(classement.begin(), classement.end());
+
+		for (size_t i = 0; i < classement.size() && i < nbCorrections; i++)
+			corrections.push_back(classement[i].second);
+		cacheCorrections.garder(motMalEcrit, nbCorrections, seuil, corrections);
 		return corrections;
 	}
 
 	/**
-	 * \fn double Dictionnaire::similitude(const std ::string& mot1, const std ::string& mot2)
+	 * \fn double Dictionnaire::similitude(const std ::string& mot1, const std ::string& mot2) const
 	 * \param[in] mot1 : Premier mot
 	  * \param[in] mot2 : Dexieme mot
 	 */
-	double Dictionnaire::similitude(const std ::string& mot1, const std ::string& mot2)
+	double Dictionnaire::similitude(const std ::string& mot1, const std ::string& mot2) const
 	{
-		int j;
-		bool streak = true;
-		double similarity = 0.;
-		std::string bigger = mot1.size() > mot2.size() ? mot1 : mot2;
-		std::string smaller = mot1.size() > mot2.size() ? mot2 : mot1;
+		return similitude(std::string_view(mot1), std::string_view(mot2));
+	}
 
-		//On parcoure chacune des lettre du plus petit mot
-		for (j=0; j < smaller.size(); j++)
-		{
-			//On parcoure le reste du mot  partir de la lettre actuelle
-			for(int i = 0; i < smaller.size() - j;i++){
-				//on teste si mot partiel est trouvable dans le plus grand mot.
-				std::string motyo = smaller.substr(j,i + 1);
-				if(bigger.find(motyo) != std::string::npos){
-					similarity++;
-				}
-			}
-			
-		}
+	/**
+	 * \fn double Dictionnaire::similitude(std::string_view mot1, std::string_view mot2) const
+	 * \param[in] mot1 : Premier mot
+	 * \param[in] mot2 : Deuxieme mot
+	 */
+	double Dictionnaire::similitude(std::string_view mot1, std::string_view mot2) const
+	{
+		return LotSimilitude::similitude(mot1, mot2);
+	}
 
-		double score = similarity  / (smaller.size() * smaller.size());
-		return score;
+	/**
+	 * \fn std::vector<double> Dictionnaire::similitudeLot(const std::string& requete, const std::vector<std::string>& candidats) const
+	 * \param[in] requete : Mot compar  tous les candidats
+	 * \param[in] candidats : Les mots  comparer
+	 */
+	std::vector<double> Dictionnaire::similitudeLot(const std::string& requete, const std::vector<std::string>& candidats) const
+	{
+		std::vector<std::string_view> vues(candidats.begin(), candidats.end());
+		std::vector<double> scores(candidats.size());
+		if (!candidats.empty())
+			LotSimilitude(requete).noter(&vues[0], vues.size(), &scores[0]);
+		return scores;
 	}
 
 
 	
 	/**
-	 * \fn std::vector<std::string> Dictionnaire::traduit(const std ::string& mot)
+	 * \fn std::vector<std::string> Dictionnaire::traduit(const std ::string& mot) const
 	 * \param[in] mot : Mot  traduire.
 	 */
-	std::vector<std::string> Dictionnaire::traduit(const std ::string& mot){
-		std::vector<std::string> traductions = _auxTraduit(racine,mot);
+	std::vector<std::string> Dictionnaire::traduit(const std ::string& mot) const {
+		elem noeud = _auxAppartient(racine, mot);
+		if (noeud == 0)
+			return std::vector<std::string>();
+
+		const NoeudDictionnaire &n = pool[noeud];
+		std::vector<std::string> traductions;
+		traductions.reserve(n.nbTraductions);
+		for (uint32_t i = n.debutTraductions; i < n.debutTraductions + n.nbTraductions; i++)
+			traductions.emplace_back(chaines.chaine(listes[i]));
 		return traductions;
 	}
 
 	/**
-	 * \fn std::vector<std::string> & Dictionnaire::_auxTraduit( elem & arbre,const std::string& mot)
-	 * \param[in] arbre : Noeud dans le dictionnaire
+	 * \fn VueTraductions Dictionnaire::vueTraductions(std::string_view mot) const
 	 * \param[in] mot : Mot  traduire.
 	 */
-	std::vector<std::string> & Dictionnaire::_auxTraduit( elem & arbre,const std::string& mot)
+	VueTraductions Dictionnaire::vueTraductions(std::string_view mot) const
 	{
-		//Si l'arbre est vide
-		if(arbre == 0){
-			std::vector<std::string> traductions;
-			return traductions;
-		}
-		
-		if(arbre->mot == mot) //Si le mot est trouv
-			return arbre->traductions;
-		else if(arbre->mot > mot)
-			_auxTraduit(arbre->gauche, mot);
-		else
-			_auxTraduit(arbre->droite, mot);
+		elem noeud = _auxAppartient(racine, mot);
+		if (noeud == 0)
+			return VueTraductions();
+		const NoeudDictionnaire &n = pool[noeud];
+		return VueTraductions(listes.data() + n.debutTraductions, &chaines, n.nbTraductions);
+	}
+
+	/**
+	 * \fn std::string Dictionnaire::traduirePhrase(std::string_view phrase) const
+	 * \param[in] phrase : Phrase  traduire
+	 */
+	std::string Dictionnaire::traduirePhrase(std::string_view phrase) const
+	{
+		return TraducteurTexte<Dictionnaire>(*this).traduirePhrase(phrase);
 	}
 
 	/**
-	 * \fn  Dictionnaire::_auxsuggereCorrections(elem & arbre,const std::string& motMalEcrit,double& min,std::vector<std::string> &corrections)
+	 * \fn void Dictionnaire::traduireTexte(std::string_view texte, std::ostream &sortie) const
+	 * \param[in] texte : Texte  traduire
+	 * \param[out] sortie : Flot o crire la traduction
+	 */
+	void Dictionnaire::traduireTexte(std::string_view texte, std::ostream &sortie) const
+	{
+		TraducteurTexte<Dictionnaire>(*this).traduireTexte(texte, sortie);
+	}
+
+	/**
+	 * \fn  void Dictionnaire::_auxsuggereCorrections(elem arbre,const std::string& motMalEcrit,MeilleursCandidats &meilleurs) const
 	 * \param[in] arbre : Noeud dans le dictionnaire
 	 * \param[in] motMalEcrit : Mot  corriger
-	  * \param[in] min : Sensibilit pour la comparaison des mots
-	   * \param[in] corrections : Liste des corrections  remplir
+	 * \param[in,out] meilleurs : Slection des meilleures corrections
 	 */
-	void Dictionnaire::_auxsuggereCorrections(elem & arbre,const std::string& motMalEcrit,double& min,std::vector<std::string> &corrections)
+	void Dictionnaire::_auxsuggereCorrections(elem arbre,const std::string& motMalEcrit,MeilleursCandidats &meilleurs) const
 		{
-			if (arbre == 0)
+			LotSimilitude lot(motMalEcrit);
+			std::string_view mots[TAILLE_LOT];
+			double scores[TAILLE_LOT];
+
+			std::vector<elem> pile;
+			if (arbre != 0)
+				pile.push_back(arbre);
+
+			while (!pile.empty())
 			{
-				return;
+				//On remplit un lot de mots
+				size_t n = 0;
+				while (!pile.empty() && n < TAILLE_LOT)
+				{
+					const NoeudDictionnaire &noeud = pool[pile.back()];
+					pile.pop_back();
+					mots[n++] = noeud.mot.vue();
+					if (noeud.droite != 0)
+						pile.push_back(noeud.droite);
+					if (noeud.gauche != 0)
+						pile.push_back(noeud.gauche);
+				}
+
+				lot.noter(mots, n, scores);
+
+				//Chaque score n'est calcul qu'une fois; la slection le garde avec son mot
+				for (size_t k = 0; k < n; k++)
+					meilleurs.proposer(scores[k], mots[k]);
 			}
-			if ( similitude(arbre->mot,motMalEcrit) > .4  ) // Si la similitude depasse la sensibilit minimal on considre le mot
+		}
+
+
+	/**
+	 * \fn  void Dictionnaire::_suggereCorrectionsParallele(const std::string& motMalEcrit, unsigned int nb, MeilleursCandidats &meilleurs) const
+	 * \param[in] motMalEcrit : Mot  corriger
+	 * \param[in] nb : Nombre de threads
+	 * \param[in,out] meilleurs : Slection des meilleures corrections
+	 *
+	 * La slection dpartage les galits par ordre alphabtique: l'ordre dans lequel les threads
+	 * voient les mots, puis la fusion, ne change donc pas le rsultat.
+	 */
+	void Dictionnaire::_suggereCorrectionsParallele(const std::string& motMalEcrit, unsigned int nb, MeilleursCandidats &meilleurs) const
+		{
+			//On descend niveau par niveau jusqu' avoir assez de sous-arbres  se partager
+			std::vector<elem> sousArbres;
+			std::vector<std::string_view> hauts;
+			if (racine != 0)
+				sousArbres.push_back(racine);
+			while (!sousArbres.empty() && sousArbres.size() < nb * SOUS_ARBRES_PAR_THREAD)
 			{
-				if(corrections.size() >= 10) // Si dj 10 corrections sont trouves
+				std::vector<elem> niveau;
+				for (size_t i = 0; i < sousArbres.size(); i++)
 				{
-					if( similitude(arbre->mot,motMalEcrit) > min) //Si la similitude du mot actuel est plus grande la minimale de la liste de corrections
-					{
-						int i = 0;
-						bool found = false;
-						while(!found && i < corrections.size())
-						{
-							// On trouve une correction avec la sensibilit minimale pour la remplacer
-							if(similitude(corrections.at(i),motMalEcrit) == min){
-								corrections.at(i) = arbre->mot;
-								found = true; 
-							}
-
-							i++;
-						}
-						min =  similitude(arbre->mot,motMalEcrit);
-					}
+					const NoeudDictionnaire &noeud = pool[sousArbres[i]];
+					hauts.push_back(noeud.mot.vue());
+					if (noeud.gauche != 0)
+						niveau.push_back(noeud.gauche);
+					if (noeud.droite != 0)
+						niveau.push_back(noeud.droite);
 				}
-				else
-					corrections.push_back(arbre->mot); // On ajoute la correction  la liste
+				sousArbres.swap(niveau);
+			}
+
+			//Chaque thread prend le prochain sous-arbre libre et garde ses propres meilleurs candidats
+			std::atomic<size_t> prochain(0);
+			unsigned int nbSelections = meilleurs.capacite();
+			double seuil = meilleurs.seuilSelection();
+			auto travail = [&]() -> MeilleursCandidats
+			{
+				MeilleursCandidats locaux(nbSelections, seuil);
+				for (size_t i = prochain++; i < sousArbres.size(); i = prochain++)
+					_auxsuggereCorrections(sousArbres[i], motMalEcrit, locaux);
+				return locaux;
+			};
+
+			std::vector<std::future<MeilleursCandidats> > resultats;
+			for (unsigned int t = 1; t < nb && t < sousArbres.size(); t++)
+				resultats.push_back(std::async(std::launch::async, travail));
+
+			//Le thread appelant travaille aussi: il note d'abord les mots du haut de l'arbre
+			if (!hauts.empty())
+			{
+				std::vector<double> scores(hauts.size());
+				LotSimilitude(motMalEcrit).noter(&hauts[0], hauts.size(), &scores[0]);
+				for (size_t i = 0; i < hauts.size(); i++)
+					meilleurs.proposer(scores[i], hauts[i]);
+			}
+			meilleurs.fusionner(travail());
+
+			//get() relance l'exception d'un thread, s'il y en a eu une
+			for (size_t t = 0; t < resultats.size(); t++)
+				meilleurs.fusionner(resultats[t].get());
+		}
+
+	/**
+	 * \fn Dictionnaire::Parcours Dictionnaire::motsAvecPrefixe(std::string_view prefixe, size_t limite) const
+	 * \param[in] prefixe : Dbut commun des mots
+	 * \param[in] limite : Nombre maximal de mots
+	 */
+	Dictionnaire::Parcours Dictionnaire::motsAvecPrefixe(std::string_view prefixe, size_t limite) const
+	{
+		return Parcours(*this, prefixe, BorneParcours::prefixe(prefixe, limite));
+	}
+
+	/**
+	 * \fn Dictionnaire::Parcours Dictionnaire::plage(std::string_view debut, std::string_view fin) const
+	 * \param[in] debut : Premier mot possible
+	 * \param[in] fin : Premier mot exclu
+	 */
+	Dictionnaire::Parcours Dictionnaire::plage(std::string_view debut, std::string_view fin) const
+	{
+		return Parcours(*this, debut, BorneParcours::superieure(fin));
+	}
+
+	/**
+	 * \fn Dictionnaire::Parcours::Parcours(const Dictionnaire &dico, std::string_view debut, const BorneParcours &borne)
+	 * \param[in] dico : Dictionnaire parcouru
+	 * \param[in] debut : Le parcours commence au premier mot au moins gal  debut
+	 * \param[in] borne : Arrt du parcours
+	 *
+	 * On garde les noeuds o la descente est partie  gauche: ce sont, du bas vers le haut,
+	 * les prochains mots en ordre.
+	 */
+	Dictionnaire::Parcours::Parcours(const Dictionnaire &dico, std::string_view debut, const BorneParcours &borne)
+		: dico(&dico), courant(0), borne(borne)
+	{
+		if (dico.racine != 0)
+			pile.reserve(dico.pool[dico.racine].hauteur + 1);
+
+		elem noeud = dico.racine;
+		while (noeud != 0)
+		{
+			if (dico.pool[noeud].mot.compare(debut) >= 0)
+			{
+				pile.push_back(noeud);
+				noeud = dico.pool[noeud].gauche;
 			}
+			else
+				noeud = dico.pool[noeud].droite;
+		}
+	}
 
+	/**
+	 * \fn bool Dictionnaire::Parcours::suivant(std::string_view &mot)
+	 * \param[out] mot : Le mot suivant
+	 */
+	bool Dictionnaire::Parcours::suivant(std::string_view &mot)
+	{
+		courant = 0;
+		if (pile.empty())
+			return false;
+
+		elem noeud = pile.back();
+		pile.pop_back();
+		std::string_view candidat = dico->pool[noeud].mot.vue();
+		if (!borne.accepte(candidat))
+		{
+			pile.clear();
+			return false;
+		}
+
+		//Le successeur est le mot le plus  gauche du sous-arbre droit
+		for (elem e = dico->pool[noeud].droite; e != 0; e = dico->pool[e].gauche)
+			pile.push_back(e);
 
-			_auxsuggereCorrections(arbre->gauche, motMalEcrit,min,corrections);
-		
-			_auxsuggereCorrections(arbre->droite, motMalEcrit,min,corrections);
+		courant = noeud;
+		mot = candidat;
+		return true;
+	}
+
+	/**
+	 * \fn VueTraductions Dictionnaire::Parcours::traductions() const
+	 */
+	VueTraductions Dictionnaire::Parcours::traductions() const
+	{
+		if (courant == 0)
+			return VueTraductions();
+		const NoeudDictionnaire &n = dico->pool[courant];
+		return VueTraductions(dico->listes.data() + n.debutTraductions, &dico->chaines, n.nbTraductions);
+	}
 
+	/**
+	 * \fn void Dictionnaire::verifierInvariants() const
+	 *
+	 * Parcours en ordre avec une pile: la profondeur de l'arbre n'est pas limite par la rcursion,
+	 * mme si l'arbre vrifi est dgnr. Chaque hauteur est compare  celles, dj vrifies
+	 * ou non, de ses enfants: si toutes les galits tiennent, toutes les hauteurs sont exactes.
+	 */
+	void Dictionnaire::verifierInvariants() const
+	{
+		std::vector<elem> pile;
+		std::string_view precedent;
+		int nbNoeuds = 0;
+
+		elem courant = racine;
+		while (courant != 0 || !pile.empty())
+		{
+			while (courant != 0)
+			{
+				pile.push_back(courant);
+				courant = pool[courant].gauche;
+			}
+			const NoeudDictionnaire &noeud = pool[pile.back()];
+			pile.pop_back();
+			std::string mot(noeud.mot.vue());
+
+			if (nbNoeuds > 0 && !(precedent < noeud.mot.vue()))
+				throw std::logic_error("verifierInvariants: les mots ne sont pas en ordre croissant\n");
+			precedent = noeud.mot.vue();
+
+			int gauche = _hauteur(noeud.gauche);
+			int droite = _hauteur(noeud.droite);
+			if (noeud.hauteur != 1 + _maximum(gauche, droite))
+				throw std::logic_error("verifierInvariants: hauteur inexacte au mot " + mot + "\n");
+			if (gauche - droite > 1 || droite - gauche > 1)
+				throw std::logic_error("verifierInvariants: noeud dsquilibr au mot " + mot + "\n");
+			if (noeud.nbTraductions == 0 || noeud.debutTraductions + noeud.nbTraductions > listes.size())
+				throw std::logic_error("verifierInvariants: traductions invalides au mot " + mot + "\n");
+
+			nbNoeuds++;
+			courant = noeud.droite;
 		}
 
+		if (nbNoeuds != cpt)
+			throw std::logic_error("verifierInvariants: le compte des mots est inexact\n");
+	}
+
+	/**
+	 * \fn void Dictionnaire::fixerNbThreads(unsigned int nb)
+	 * \param[in] nb : Nombre de threads (0 pour un par coeur)
+	 */
+	void Dictionnaire::fixerNbThreads(unsigned int nb)
+	{
+		nbThreads = nb;
+	}
+
+	/**
+	 * \fn void Dictionnaire::fixerTailleCacheCorrections(size_t nb)
+	 * \param[in] nb : Nombre de mots mal crits gards (0 pour dsactiver le cache)
+	 */
+	void Dictionnaire::fixerTailleCacheCorrections(size_t nb)
+	{
+		cacheCorrections.fixerCapacite(nb);
+	}
+
+	/**
+	 * \fn unsigned long long Dictionnaire::nbSuccesCacheCorrections() const
+	 */
+	unsigned long long Dictionnaire::nbSuccesCacheCorrections() const
+	{
+		return cacheCorrections.nbSucces();
+	}
+
+	/**
+	 * \fn unsigned long long Dictionnaire::nbEchecsCacheCorrections() const
+	 */
+	unsigned long long Dictionnaire::nbEchecsCacheCorrections() const
+	{
+		return cacheCorrections.nbEchecs();
+	}
 
 	/**
 	 * \fn  void Dictionnaire::_auxEnlever( elem & arbre, const std::string& mot)
@@ -205,126 +566,194 @@ namespace TP2P1
 	 */
 	void Dictionnaire::_auxEnlever( elem & arbre, const std::string& mot)
 	{
-		if( arbre->mot.compare(mot) >  0)
-			_auxEnlever( arbre->gauche, mot);
+		//On descend jusqu'au lien qui pointe sur le noeud du mot, en gardant les liens traverss
+		chemin.clear();
+		elem * lien = &arbre;
+		int comparaison;
+		while (*lien != 0 && (comparaison = pool[*lien].mot.compare(mot)) != 0)
+		{
+			chemin.push_back(lien);
+			lien = (comparaison > 0) ? &pool[*lien].gauche : &pool[*lien].droite;
+		}
 
-		else if( arbre->mot.compare(mot) < 0 )
-			_auxEnlever( arbre->droite, mot);
+		if (*lien == 0)
+			return;
 
-		// si on se rend jusqu'ici, c'est qu'on a trouv le noeud
-		// qui contient la valeur recherche
-		else if( arbre->gauche != 0 && arbre->droite != 0 ) 
+		elem noeud = *lien;
+		if( pool[noeud].gauche != 0 && pool[noeud].droite != 0 ) 
 		{
 			// deux enfants: il faut trouver la valeur suivante dans la
 			// squence et la mettre  la place de la valeur du noeud actuel
-	        
+			chemin.push_back(lien);
+
 			//chercher le noeud qui contient la valeur minimale dans le sous-arbre de droite
-			elem temp = arbre->droite;
-			while ( temp->gauche != 0) temp = temp->gauche;
-			arbre->mot = temp->mot;
-			_auxRetireMin( arbre->droite ); // Retirer minimum dans le sous-arbre droit
+			elem * min = &pool[noeud].droite;
+			while (pool[*min].gauche != 0)
+			{
+				chemin.push_back(min);
+				min = &pool[*min].gauche;
+			}
+
+			elem successeur = *min;
+			pool[noeud].mot.swap(pool[successeur].mot);
+			std::swap(pool[noeud].debutTraductions, pool[successeur].debutTraductions);
+			std::swap(pool[noeud].nbTraductions, pool[successeur].nbTraductions);
+			*min = pool[successeur].droite; // Retirer minimum dans le sous-arbre droit
+			noeud = successeur;
 		}
 		else
 		{
 			// le noeud n'a aucun enfant ou qu'un seul enfant, il suffit donc de retirer
 			// ce noeud et pointer sur l'ventuel enfant 
-			elem vieuxNoeud = arbre;
-			arbre = ( arbre->gauche != 0 ) ? arbre->gauche : arbre->droite;  
-			delete vieuxNoeud;  
-			cpt--;
-		}	
+			*lien = ( pool[noeud].gauche != 0 ) ? pool[noeud].gauche : pool[noeud].droite;  
+		}
+		listesPerdues += pool[noeud].nbTraductions;
+		pool.liberer(noeud);
+		cpt--;
+
+		//On remonte le chemin; une rotation peut rduire la hauteur, il faut alors continuer
+		for (size_t i = chemin.size(); i-- > 0; )
+		{
+			elem & courant = *chemin[i];
+			int ancienne = pool[courant].hauteur;
+			_equilibrer(courant);
+			if (pool[courant].hauteur == ancienne) //Les anctres ne changent pas
+				break;
+		}
+
+		//Les intervalles abandonns sont rcuprs quand ils forment plus de la moiti de la liste;
+		//faute de mmoire, on ressaiera au prochain retrait
+		if (2 * listesPerdues > listes.size())
+		{
+			try
+			{
+				_compacterListes();
+			}
+			catch (const std::bad_alloc &)
+			{
+			}
+		}
 	}
 
 
 	/**
-	 * \fn void Dictionnaire:: _auxRetireMin( elem & arbre) const
-	 * \param[in] arbre : Noeud dans le dictionnaire
+	 * \fn void Dictionnaire::_equilibrer( elem & noeud)
+	 * \param[in] noeud : Noeud dans le dictionnaire
 	 */
-	void Dictionnaire:: _auxRetireMin( elem & arbre) const
+	void Dictionnaire::_equilibrer( elem & noeud)
 	{
-		
-		if (arbre->gauche != 0)
-			_auxRetireMin(arbre->gauche );
+		NoeudDictionnaire &n = pool[noeud];
+		int gauche = _hauteur(n.gauche);
+		int droite = _hauteur(n.droite);
+
+		if (gauche - droite == 2)
+		{
+			if (_hauteur(pool[n.gauche].gauche) >= _hauteur(pool[n.gauche].droite))
+				_zigZigGauche(noeud);
+			else
+				_zigZagGauche(noeud);
+		}
+		else if (droite - gauche == 2)
+		{
+			if (_hauteur(pool[n.droite].droite) >= _hauteur(pool[n.droite].gauche))
+				_zigZigDroit(noeud);
+			else
+				_zigZagDroit(noeud);
+		}
 		else
 		{
-			elem tmp = arbre;
-			arbre = arbre->droite;
-			delete tmp;
+			n.hauteur = 1 + _maximum(gauche, droite);
 		}
 	}
 
 
 	/**
-	 * \fn Dictionnaire::elem Dictionnaire::_auxAppartient(elem arbre, const std::string &mot) const
+	 * \fn Dictionnaire::elem Dictionnaire::_auxAppartient(elem arbre, std::string_view mot) const
 	 * \param[in] arbre : Noeud dans le dictionnaire
 	 * \param[in] mot : Mot  trouver
 	 */
-	 Dictionnaire::elem Dictionnaire::_auxAppartient(elem arbre, const std::string &mot) const
+	 Dictionnaire::elem Dictionnaire::_auxAppartient(elem arbre, std::string_view mot) const
 	 {
-		 if (arbre == 0)
-			return 0;
-
-		 if ( arbre->mot.compare(mot) == 0  )
-			return arbre;
-
-		if ( arbre->mot.compare(mot) > 0 )
-			return _auxAppartient(arbre->gauche, mot);
-		else
-			return _auxAppartient(arbre->droite, mot);
-		
+		while (arbre != 0)
+		{
+			const NoeudDictionnaire &noeud = pool[arbre];
+			int comparaison = noeud.mot.compare(mot);
+			if (comparaison == 0)
+				return arbre;
+			arbre = (comparaison > 0) ? noeud.gauche : noeud.droite;
+		}
+		return 0;
 	 }
 
 	 /**
-	 * \fn void Dictionnaire::_auxInserer(elem &arbre, const std::string &motOriginal, const std::string &motTraduit)
+	 * \fn void Dictionnaire::_auxInserer(elem &arbre, std::string_view motOriginal, std::string_view motTraduit)
 	 * \param[in] arbre : Noeud dans le dictionnaire
 	 * \param[in] motOriginal : Mot  insrer
 	 * \param[in] motTraduit : Traduction possible
 	 */
-	void Dictionnaire::_auxInserer(elem &arbre, const std::string &motOriginal, const std::string &motTraduit)
+	void Dictionnaire::_auxInserer(elem &arbre, std::string_view motOriginal, std::string_view motTraduit)
 	{
-		//Si l'arbre est vide
-		if (arbre == 0)
+		//Les liens gards dans chemin pointent dans le pool: il ne doit pas tre dplac par allouer()
+		pool.reserver(1);
+
+		//On descend en gardant les liens traverss
+		chemin.clear();
+		elem * lien = &arbre;
+		while (*lien != 0)
 		{
-			arbre = new NoeudDictionnaire(motOriginal,motTraduit);
-			cpt++;
-			return;
-		}
-		else if(arbre->mot.compare(motOriginal) == 0){ //Si le mot est dj prsent on insre seulement ses traductions
-			arbre->traductions.push_back(motTraduit);
-			return;
-		}
-		if( arbre->mot.compare(motOriginal) > 0 ) //Sinon on insre a gauche ou a droite
-		{	_auxInserer(arbre->gauche, motOriginal,motTraduit);
-			if ((_hauteur(arbre->gauche) - _hauteur(arbre->droite)) == 2) //quilibre
+			int comparaison = pool[*lien].mot.compare(motOriginal);
+			if (comparaison == 0) //Si le mot est dj prsent on insre seulement ses traductions
 			{
-				if (arbre->gauche->mot.compare(motOriginal) > 0)
-					_zigZigGauche(arbre);
-			   else
-					_zigZagGauche(arbre);
-			} 
-			else
-			{
-				arbre->hauteur = 1 + _maximum(_hauteur(arbre->gauche), _hauteur(arbre->droite));
+				_ajouterTraduction(pool[*lien], chaines.interner(motTraduit));
+				return;
 			}
+			chemin.push_back(lien);
+			lien = (comparaison > 0) ? &pool[*lien].gauche : &pool[*lien].droite; //Sinon on insre a gauche ou a droite
 		}
-		else
+
+		uint32_t traduction = chaines.interner(motTraduit);
+		listes.push_back(traduction);
+		try
+		{
+			*lien = pool.allouer(motOriginal, static_cast<uint32_t>(listes.size() - 1));
+		}
+		catch (...)
+		{
+			listes.pop_back();
+			throw;
+		}
+		index.ajouter(motOriginal);
+		cpt++;
+
+		//On remonte le chemin pour mettre les hauteurs  jour et rquilibrer
+		for (size_t i = chemin.size(); i-- > 0; )
 		{
-			_auxInserer(arbre->droite, motOriginal,motTraduit);
-			if ((_hauteur(arbre->droite) - _hauteur(arbre->gauche)) == 2)  //quilibre
+			elem & noeud = *chemin[i];
+			NoeudDictionnaire &n = pool[noeud];
+			int gauche = _hauteur(n.gauche);
+			int droite = _hauteur(n.droite);
+
+			if (gauche - droite == 2) //quilibre
 			{
-				if ( arbre->droite->mot.compare(motOriginal) <= 0) // pour le cas d'un doublon
-				{
-					_zigZigDroit(arbre);
-				} 
+				if (pool[n.gauche].mot.compare(motOriginal) > 0)
+					_zigZigGauche(noeud);
 				else
-				{
-					_zigZagDroit(arbre);
-				}
-			} 
-			else
+					_zigZagGauche(noeud);
+				return; //Aprs une rotation, le sous-arbre a retrouv sa hauteur d'avant l'insertion
+			}
+			if (droite - gauche == 2)
 			{
-				arbre->hauteur = 1 + _maximum(_hauteur(arbre->droite), _hauteur(arbre->gauche));
+				if (pool[n.droite].mot.compare(motOriginal) < 0)
+					_zigZigDroit(noeud);
+				else
+					_zigZagDroit(noeud);
+				return;
 			}
+
+			int hauteur = 1 + _maximum(gauche, droite);
+			if (hauteur == n.hauteur) //Les anctres ne changent pas non plus
+				return;
+			n.hauteur = hauteur;
 		}
 	}
 
@@ -337,7 +766,7 @@ namespace TP2P1
 	{
 		if (noeud == 0)
 			return -1;
-		return noeud->hauteur;
+		return pool[noeud].hauteur;
 	}
 
 
@@ -363,11 +792,11 @@ namespace TP2P1
 	{
 		elem K1;
 
-		K1 = K2->gauche;
-		K2->gauche = K1->droite;
-		K1->droite = K2;
-		K2->hauteur = 1 + _maximum(_hauteur(K2->gauche), _hauteur(K2->droite));
-		K1->hauteur = 1 + _maximum(_hauteur(K1->gauche), K2->hauteur);
+		K1 = pool[K2].gauche;
+		pool[K2].gauche = pool[K1].droite;
+		pool[K1].droite = K2;
+		pool[K2].hauteur = 1 + _maximum(_hauteur(pool[K2].gauche), _hauteur(pool[K2].droite));
+		pool[K1].hauteur = 1 + _maximum(_hauteur(pool[K1].gauche), pool[K2].hauteur);
 
 		K2 = K1;
 	}
@@ -380,11 +809,11 @@ namespace TP2P1
 	{
 		elem K1;
 
-		K1 = K2->droite;
-		K2->droite = K1->gauche;
-		K1->gauche = K2;
-		K2->hauteur = 1 + _maximum(_hauteur(K2->droite), _hauteur(K2->gauche));
-		K1->hauteur = 1 + _maximum(_hauteur(K1->droite), K2->hauteur);
+		K1 = pool[K2].droite;
+		pool[K2].droite = pool[K1].gauche;
+		pool[K1].gauche = K2;
+		pool[K2].hauteur = 1 + _maximum(_hauteur(pool[K2].droite), _hauteur(pool[K2].gauche));
+		pool[K1].hauteur = 1 + _maximum(_hauteur(pool[K1].droite), pool[K2].hauteur);
 		K2 = K1;
 	}
 
@@ -394,7 +823,7 @@ namespace TP2P1
 	 */
 	void Dictionnaire:: _zigZagGauche(elem &K3)
 	{
-		_zigZigDroit(K3->gauche);
+		_zigZigDroit(pool[K3].gauche);
 		_zigZigGauche(K3);
 	}
 
@@ -404,7 +833,7 @@ namespace TP2P1
 	 */
 	void Dictionnaire:: _zigZagDroit(elem & K3)
 	{
-		_zigZigGauche(K3->droite);
+		_zigZigGauche(pool[K3].droite);
 		_zigZigDroit(K3);
 	}
 
@@ -412,17 +841,178 @@ namespace TP2P1
 	 * \fn void  Dictionnaire::_auxDetruire(Dictionnaire::elem &t)
 	 *
 	 * \param[in] t : Le sous-arbre  dtruire
+	 *
+	 * Sans pile: tant que le noeud courant a un enfant gauche, une rotation le fait remonter;
+	 * sinon, le noeud est dtruit et on passe  son enfant droit.
 	 */
 	void  Dictionnaire::_auxDetruire(Dictionnaire::elem &t)
 	{
-		if (t != 0)
+		elem noeud = t;
+		while (noeud != 0)
+		{
+			if (pool[noeud].gauche != 0)
+			{
+				elem gauche = pool[noeud].gauche;
+				pool[noeud].gauche = pool[gauche].droite;
+				pool[gauche].droite = noeud;
+				noeud = gauche;
+			}
+			else
+			{
+				elem droite = pool[noeud].droite;
+				pool.liberer(noeud);
+				cpt--;
+				noeud = droite;
+			}
+		}
+		t = 0;
+	}
+
+	/**
+	 * \fn Dictionnaire::PoolNoeuds::PoolNoeuds()
+	 *
+	 * La case 0 est occupe par un noeud vide qui ne sera jamais donn.
+	 */
+	Dictionnaire::PoolNoeuds::PoolNoeuds()
+	{
+		noeuds.emplace_back(std::string_view(), 0);
+		libres = 0;
+		nbLibres = 0;
+	}
+
+	/**
+	 * \fn Dictionnaire::elem Dictionnaire::PoolNoeuds::allouer(std::string_view motOriginal, uint32_t debutTraductions)
+	 * \param[in] motOriginal : Mot du nouveau noeud
+	 * \param[in] debutTraductions : Le dbut de ses traductions dans listes
+	 */
+	Dictionnaire::elem Dictionnaire::PoolNoeuds::allouer(std::string_view motOriginal, uint32_t debutTraductions)
+	{
+		if (libres != 0) //On reprend d'abord une place libre
+		{
+			elem place = libres;
+			NoeudDictionnaire &noeud = noeuds[place];
+			noeud.mot = MotCompact(motOriginal);
+			libres = noeud.gauche;
+			nbLibres--;
+			noeud.debutTraductions = debutTraductions;
+			noeud.gauche = 0;
+			noeud.droite = 0;
+			noeud.nbTraductions = 1;
+			noeud.hauteur = 0;
+			return place;
+		}
+
+		if (noeuds.size() > UINT32_MAX)
+			throw std::length_error("PoolNoeuds: trop de noeuds\n");
+		noeuds.emplace_back(motOriginal, debutTraductions);
+		return static_cast<elem>(noeuds.size() - 1);
+	}
+
+	/**
+	 * \fn void Dictionnaire::PoolNoeuds::liberer(elem noeud)
+	 * \param[in] noeud : Noeud  librer
+	 */
+	void Dictionnaire::PoolNoeuds::liberer(elem noeud)
+	{
+		noeuds[noeud].mot = MotCompact();
+		noeuds[noeud].gauche = libres;
+		libres = noeud;
+		nbLibres++;
+	}
+
+	/**
+	 * \fn void Dictionnaire::PoolNoeuds::reserver(size_t nb)
+	 * \param[in] nb : Le nombre de noeuds  allouer sans dplacer le vecteur
+	 */
+	void Dictionnaire::PoolNoeuds::reserver(size_t nb)
+	{
+		if (nb <= nbLibres)
+			return;
+
+		size_t besoin = noeuds.size() + nb - nbLibres;
+		if (besoin > noeuds.capacity())
+			noeuds.reserve(std::max(besoin, 2 * noeuds.capacity()));
+	}
+
+	/**
+	 * \fn Dictionnaire::NoeudDictionnaire & Dictionnaire::PoolNoeuds::operator[](elem noeud)
+	 * \param[in] noeud : L'indice d'un noeud
+	 */
+	Dictionnaire::NoeudDictionnaire & Dictionnaire::PoolNoeuds::operator[](elem noeud)
+	{
+		return noeuds[noeud];
+	}
+
+	/**
+	 * \fn const Dictionnaire::NoeudDictionnaire & Dictionnaire::PoolNoeuds::operator[](elem noeud) const
+	 * \param[in] noeud : L'indice d'un noeud
+	 */
+	const Dictionnaire::NoeudDictionnaire & Dictionnaire::PoolNoeuds::operator[](elem noeud) const
+	{
+		return noeuds[noeud];
+	}
+
+	/**
+	 * \fn void Dictionnaire::_ajouterTraduction(NoeudDictionnaire &noeud, uint32_t traduction)
+	 * \param[in,out] noeud : Le noeud du mot
+	 * \param[in] traduction : L'identifiant de la traduction dans chaines
+	 */
+	void Dictionnaire::_ajouterTraduction(NoeudDictionnaire &noeud, uint32_t traduction)
+	{
+		if (noeud.nbTraductions == MAX_TRADUCTIONS)
+			throw std::length_error("ajouteMot: trop de traductions pour le mot " + std::string(noeud.mot.vue()) + "\n");
+
+		size_t fin = noeud.debutTraductions + noeud.nbTraductions;
+		if (fin != listes.size())
+		{
+			//L'intervalle est recopi  la fin; sa place d'avant est perdue
+			listes.reserve(listes.size() + noeud.nbTraductions + 1);
+			size_t debut = listes.size();
+			for (size_t i = noeud.debutTraductions; i < fin; i++)
+				listes.push_back(listes[i]);
+			listesPerdues += noeud.nbTraductions;
+			noeud.debutTraductions = static_cast<uint32_t>(debut);
+		}
+		listes.push_back(traduction);
+		noeud.nbTraductions++;
+	}
+
+	/**
+	 * \fn void Dictionnaire::_compacterListes()
+	 */
+	void Dictionnaire::_compacterListes()
+	{
+		//On alloue tout avant de modifier le premier noeud
+		std::vector<uint32_t> compacte;
+		compacte.reserve(listes.size() - listesPerdues);
+		std::vector<elem> ordre;
+		ordre.reserve(cpt);
+
+		std::vector<elem> pile;
+		if (racine != 0)
+			pile.push_back(racine);
+		while (!pile.empty())
+		{
+			elem noeud = pile.back();
+			pile.pop_back();
+			ordre.push_back(noeud);
+			if (pool[noeud].droite != 0)
+				pile.push_back(pool[noeud].droite);
+			if (pool[noeud].gauche != 0)
+				pile.push_back(pool[noeud].gauche);
+		}
+
+		for (size_t i = 0; i < ordre.size(); i++)
 		{
-			_auxDetruire(t->gauche);
-			_auxDetruire(t->droite);
-			delete t;
-			cpt--;
-			t= 0;
+			NoeudDictionnaire &noeud = pool[ordre[i]];
+			size_t debut = compacte.size();
+			compacte.insert(compacte.end(), listes.begin() + noeud.debutTraductions,
+			                listes.begin() + noeud.debutTraductions + noeud.nbTraductions);
+			noeud.debutTraductions = static_cast<uint32_t>(debut);
 		}
+
+		listes.swap(compacte);
+		listesPerdues = 0;
 	}
 
 		/**
@@ -432,73 +1022,151 @@ namespace TP2P1
 	 */
 	void Dictionnaire::chargerDictionnaire(std::ifstream &fichier)
 	{   
-		char ligne[200];  /* pour contenir une ligne lu dans le fichier */  
-		char *mot, *motTraduit; /* le mot dans la langue original et sa traduction */
-		char *ptr;              /* un pointeur de service */
-		int posT, posD; /* pour identifier la position d'un tilde ou d'un double-point(:) */
-		bool contexte;  /* indique la prsence d'un contexte entre () juste aprs le mot original */
-		char *saveptr;
 		/* Vrifier si le fichier est correctement ouvert */
-		if (fichier == NULL)
+		if (!fichier)
 		{   
 			return;
 		}
 
-		
-		/* Lire le fichier et ajouter les mots leur(s) traduction(s) */
+		/* Lire tout le fichier d'un coup */
+		std::string texte((std::istreambuf_iterator<char>(fichier)), std::istreambuf_iterator<char>());
+		chargerTexte(texte);
+	}
+
+	/**
+	 * \fn bool _jetonSuivant(std::string_view &reste, const char *separateurs, std::string_view &jeton)
+	 *
+	 * \param[in,out] reste : Le texte qui reste  dcouper
+	 * \param[in] separateurs : Les caractres qui sparent les jetons
+	 * \param[out] jeton : Le jeton trouv
+	 *
+	 * Mme dcoupage que strtok(): les sparateurs du dbut sont sauts et le sparateur qui
+	 * termine le jeton est consomm. Retourne false s'il ne reste aucun jeton.
+	 */
+	static bool _jetonSuivant(std::string_view &reste, const char *separateurs, std::string_view &jeton)
+	{
+		size_t debut = reste.find_first_not_of(separateurs);
+		if (debut == std::string_view::npos)
+		{
+			reste = std::string_view();
+			return false;
+		}
+
+		size_t fin = reste.find_first_of(separateurs, debut);
+		if (fin == std::string_view::npos)
+		{
+			jeton = reste.substr(debut);
+			reste = std::string_view();
+		}
+		else
+		{
+			jeton = reste.substr(debut, fin - debut);
+			reste = reste.substr(fin + 1);
+		}
+		return true;
+	}
+
+	/**
+	 * \fn void Dictionnaire::chargerTexte(std::string_view texte)
+	 *
+	 * \param[in] texte : Le contenu du fichier de dictionnaire
+	 */
+	void Dictionnaire::chargerTexte(std::string_view texte)
+	{
+		std::vector<Paire> paires;  /* les paires (mot, traduction) du texte */
+
+		/* Lire le texte et ajouter les mots leur(s) traduction(s) */
 		std::cout <<  " Chargement du dictionnaire... " <<  std::endl;
-		while (!fichier. eof())
+		analyserTexte(texte, paires);
+
+		if (racine == 0)
+		{
+			_construireEquilibre(paires);
+		}
+		else
 		{
-			/* lecture d'une ligne */
-			fichier.getline(ligne, 199);
-        
+			for (size_t i = 0; i < paires.size(); i++)
+				_auxInserer(racine, paires[i].first, paires[i].second);
+		}
+	}
+
+	/**
+	 * \fn void Dictionnaire::analyserTexte(std::string_view texte, std::vector<Paire> &paires)
+	 *
+	 * \param[in] texte : Le contenu d'un fichier de dictionnaire
+	 * \param[in,out] paires : Les paires (mot, traduction) trouves
+	 */
+	void Dictionnaire::analyserTexte(std::string_view texte, std::vector<Paire> &paires)
+	{
+		std::string_view ligne;     /* une ligne du fichier, sans le saut de ligne */
+		std::string_view reste;     /* ce qui reste  dcouper dans la ligne */
+		std::string_view mot, motTraduit; /* le mot dans la langue original et sa traduction */
+		std::string_view ignore;    /* un jeton saut */
+		size_t posT, posD; /* pour identifier la position d'un tilde ou d'un double-point(:) */
+		bool contexte;  /* indique la prsence d'un contexte entre () juste aprs le mot original */
+
+		while (!texte.empty())
+		{
+			/* dcouper une ligne */
+			size_t finLigne = texte.find('\n');
+			if (finLigne == std::string_view::npos)
+			{
+				ligne = texte;
+				texte = std::string_view();
+			}
+			else
+			{
+				ligne = texte.substr(0, finLigne);
+				texte = texte.substr(finLigne + 1);
+			}
+			if (!ligne.empty() && ligne.back() == '\r')
+			{
+				ligne.remove_suffix(1);
+			}
+
 			/* Ignorer les lignes d'en-tte */
-			if (ligne[0] == '#')
+			if (!ligne.empty() && ligne[0] == '#')
 			{
 				continue;
 			}
 
-			posT = 0;
-			posD = 0;
-
-			ptr = strchr(ligne, '~');
-			if (ptr != NULL)
+			posT = ligne.find('~');
+			if (posT == std::string_view::npos)
 			{
-				posT = (ptr - ligne) / sizeof(char);
+				posT = 0;
 			}
 
-			ptr = strchr(ligne, ':');
-			if (ptr != NULL)
+			posD = ligne.find(':');
+			if (posD == std::string_view::npos)
 			{
-				posD = (ptr - ligne) / sizeof(char);
+				posD = 0;
 			}
 
 			/* Vrifier s'il y a un contexte entre parenthses  */
 			/* tout de suite aprs le mot original              */
-			contexte = false;
-			ptr = strchr(ligne, '\t');
-			if (ptr != NULL)
+			size_t posTab = ligne.find('\t');
+			contexte = posTab != std::string_view::npos && posTab + 1 < ligne.size() && ligne[posTab + 1] == '(';
+
+			/* Aller chercher le mot original */
+			reste = ligne;
+			if (!_jetonSuivant(reste, "\t", mot))
 			{
-				if (*(ptr + 1) == '(')
-				{
-					contexte = true;
-				}
+				continue;
 			}
 
-			/* Aller chercher le mot original */
-			mot = strtok(ligne, "\t");
-        
 			/* Passer le contexte s'il y a lieu */
 			if (contexte == true)
 			{
-				ptr = strtok(NULL, "()");
+				_jetonSuivant(reste, "()", ignore);
 			}
 
+			bool trouve;
+
 			/* Traiter les cas comme celui-ci :                                                           */
 			/* a	un(e): ~ book = un livre. 2.(instead of number one) ~ year ago; il y a un an[Article] */
 			if (posD < posT)
 			{
-				motTraduit = strtok(NULL, ":");
+				trouve = _jetonSuivant(reste, ":", motTraduit);
 			}
 
 			else
@@ -507,23 +1175,217 @@ namespace TP2P1
 				/* abode	of no fixed ~ :sans domicile fixe[Noun] */
 				if (posT < posD)
 				{
-					ptr = strtok(NULL, ":");
-					motTraduit = strtok(NULL, "([,;\n");
+					_jetonSuivant(reste, ":", ignore);
+					trouve = _jetonSuivant(reste, "([,;\n", motTraduit);
 				}
 				else
 				{
 					/* obtenir la traduction */
-					motTraduit = strtok(NULL, "([,;\n");
+					trouve = _jetonSuivant(reste, "([,;\n", motTraduit);
 				}
 			}
-		    
-			std::string sMotTraduit = motTraduit;
-			std::string sMot = mot;
 
-			ajouteMot(sMot,sMotTraduit);
-			
-   
+			/* Une ligne sans traduction est ignore */
+			if (trouve)
+			{
+				paires.push_back(Paire(mot, motTraduit));
+			}
+		}
+	}
+
+	/**
+	 * \fn bool _motPlusPetit(const std::pair<std::string_view, std::string_view> &a, const std::pair<std::string_view, std::string_view> &b)
+	 *
+	 * \param[in] a : Premire paire
+	 * \param[in] b : Deuxime paire
+	 *
+	 * Compare seulement les mots: un tri stable garde les traductions d'un mot dans l'ordre du fichier.
+	 */
+	static bool _motPlusPetit(const std::pair<std::string_view, std::string_view> &a, const std::pair<std::string_view, std::string_view> &b)
+	{
+		return a.first < b.first;
+	}
+
+	/**
+	 * \fn void Dictionnaire::_construireEquilibre(std::vector<Paire> &paires)
+	 *
+	 * \param[in,out] paires : Les paires (mot, traduction), tries au besoin
+	 */
+	void Dictionnaire::_construireEquilibre(std::vector<Paire> &paires)
+	{
+		if (!std::is_sorted(paires.begin(), paires.end(), _motPlusPetit))
+		{
+			std::stable_sort(paires.begin(), paires.end(), _motPlusPetit);
+		}
+
+		//groupes[k] est l'indice de la premire paire du k-ime mot; la dernire case marque la fin
+		std::vector<size_t> groupes;
+		for (size_t i = 0; i < paires.size(); i++)
+		{
+			if (i == 0 || paires[i].first != paires[i - 1].first)
+				groupes.push_back(i);
+		}
+		size_t nbMots = groupes.size();
+		groupes.push_back(paires.size());
+
+		pool.reserver(nbMots);
+		listes.reserve(paires.size());
+		racine = _auxConstruire(paires, groupes, 0, nbMots);
+		cpt = static_cast<int>(nbMots);
+		chaines.ajuster();
+	}
+
+	/**
+	 * \fn Dictionnaire::elem Dictionnaire::_auxConstruire(const std::vector<Paire> &paires, const std::vector<size_t> &groupes, size_t debut, size_t fin)
+	 *
+	 * \param[in] paires : Les paires (mot, traduction) en ordre
+	 * \param[in] groupes : Le dbut des paires de chaque mot
+	 * \param[in] debut : Le premier mot du sous-arbre
+	 * \param[in] fin : Le mot qui suit le dernier mot du sous-arbre
+	 */
+	Dictionnaire::elem Dictionnaire::_auxConstruire(const std::vector<Paire> &paires, const std::vector<size_t> &groupes, size_t debut, size_t fin)
+	{
+		if (debut >= fin)
+			return 0;
+
+		size_t milieu = debut + (fin - debut) / 2;
+		size_t premiere = groupes[milieu];
+
+		if (groupes[milieu + 1] - premiere > MAX_TRADUCTIONS)
+			throw std::length_error("_auxConstruire: trop de traductions pour le mot " + std::string(paires[premiere].first) + "\n");
+
+		//Les traductions d'un mot sont contigus dans listes
+		elem noeud = pool.allouer(paires[premiere].first, static_cast<uint32_t>(listes.size()));
+		for (size_t i = premiere; i < groupes[milieu + 1]; i++)
+			listes.push_back(chaines.interner(paires[i].second));
+		pool[noeud].nbTraductions = static_cast<uint16_t>(groupes[milieu + 1] - premiere);
+		index.ajouter(paires[premiere].first);
+
+		elem gauche = _auxConstruire(paires, groupes, debut, milieu);
+		elem droite = _auxConstruire(paires, groupes, milieu + 1, fin);
+		pool[noeud].gauche = gauche;
+		pool[noeud].droite = droite;
+		pool[noeud].hauteur = 1 + _maximum(_hauteur(gauche), _hauteur(droite));
+		return noeud;
+	}
+
+	/**
+	 * \fn size_t Dictionnaire::_verifierLot(const std::vector<Paire> &paires) const
+	 *
+	 * \param[in] paires : Les paires (mot, traduction), tries par mot
+	 *
+	 * Un mot du lot est cherch une seule fois, quel que soit son nombre de traductions: O(k log n).
+	 */
+	size_t Dictionnaire::_verifierLot(const std::vector<Paire> &paires) const
+	{
+		size_t nouveaux = 0;
+		for (size_t i = 0; i < paires.size(); )
+		{
+			size_t fin = i + 1;
+			while (fin < paires.size() && paires[fin].first == paires[i].first)
+				fin++;
+
+			size_t existantes = 0;
+			elem noeud = _auxAppartient(racine, paires[i].first);
+			if (noeud != 0)
+				existantes = pool[noeud].nbTraductions;
+			else
+				nouveaux++;
+			if (existantes + fin - i > MAX_TRADUCTIONS)
+				throw std::length_error("fusionner: trop de traductions pour le mot " + std::string(paires[i].first) + "\n");
+			i = fin;
+		}
+		return nouveaux;
+	}
+
+	/**
+	 * \fn void Dictionnaire::_fusionnerTrie(const std::vector<Paire> &paires, size_t nouveaux)
+	 *
+	 * \param[in] paires : Les paires (mot, traduction), tries par mot
+	 * \param[in] nouveaux : Le nombre de mots du lot absents de l'arbre
+	 *
+	 * Les deux suites sont fusionnes en ordre; l'arbre n'est rebranch qu' la fin.
+	 */
+	void Dictionnaire::_fusionnerTrie(const std::vector<Paire> &paires, size_t nouveaux)
+	{
+		//Les noeuds de l'arbre, en ordre
+		std::vector<elem> ordre;
+		ordre.reserve(cpt);
+		std::vector<elem> pile;
+		for (elem noeud = racine; noeud != 0 || !pile.empty(); )
+		{
+			for (; noeud != 0; noeud = pool[noeud].gauche)
+				pile.push_back(noeud);
+			noeud = pile.back();
+			pile.pop_back();
+			ordre.push_back(noeud);
+			noeud = pool[noeud].droite;
+		}
+
+		pool.reserver(nouveaux);
+		std::vector<elem> fusion;
+		fusion.reserve(ordre.size() + nouveaux);
+		std::vector<elem> ajoutes;
+		ajoutes.reserve(nouveaux);
+
+		for (size_t i = 0, j = 0; i < paires.size() || j < ordre.size(); )
+		{
+			if (i == paires.size() || (j < ordre.size() && pool[ordre[j]].mot.compare(paires[i].first) < 0))
+			{
+				fusion.push_back(ordre[j++]);
+				continue;
+			}
+
+			size_t fin = i + 1;
+			while (fin < paires.size() && paires[fin].first == paires[i].first)
+				fin++;
+
+			if (j < ordre.size() && pool[ordre[j]].mot.compare(paires[i].first) == 0)
+			{
+				//Mot dj prsent: ses nouvelles traductions suivent les siennes
+				for (size_t k = i; k < fin; k++)
+					_ajouterTraduction(pool[ordre[j]], chaines.interner(paires[k].second));
+				fusion.push_back(ordre[j++]);
+			}
+			else
+			{
+				//Nouveau mot: ses traductions sont contigus dans listes
+				elem noeud = pool.allouer(paires[i].first, static_cast<uint32_t>(listes.size()));
+				for (size_t k = i; k < fin; k++)
+					listes.push_back(chaines.interner(paires[k].second));
+				pool[noeud].nbTraductions = static_cast<uint16_t>(fin - i);
+				fusion.push_back(noeud);
+				ajoutes.push_back(noeud);
+			}
+			i = fin;
 		}
+
+		racine = _auxRelier(fusion, 0, fusion.size());
+		cpt += static_cast<int>(ajoutes.size());
+		for (size_t k = 0; k < ajoutes.size(); k++)
+			index.ajouter(pool[ajoutes[k]].mot.vue());
+	}
+
+	/**
+	 * \fn Dictionnaire::elem Dictionnaire::_auxRelier(const std::vector<elem> &noeuds, size_t debut, size_t fin)
+	 *
+	 * \param[in] noeuds : Les noeuds en ordre
+	 * \param[in] debut : Le premier noeud du sous-arbre
+	 * \param[in] fin : Le noeud qui suit le dernier noeud du sous-arbre
+	 */
+	Dictionnaire::elem Dictionnaire::_auxRelier(const std::vector<elem> &noeuds, size_t debut, size_t fin)
+	{
+		if (debut >= fin)
+			return 0;
+
+		size_t milieu = debut + (fin - debut) / 2;
+		elem gauche = _auxRelier(noeuds, debut, milieu);
+		elem droite = _auxRelier(noeuds, milieu + 1, fin);
+		NoeudDictionnaire &n = pool[noeuds[milieu]];
+		n.gauche = gauche;
+		n.droite = droite;
+		n.hauteur = static_cast<int8_t>(1 + _maximum(_hauteur(gauche), _hauteur(droite)));
+		return noeuds[milieu];
 	}
 
 
@@ -15,10 +15,23 @@
 #include <iostream>
 #include <fstream> // pour les fichiers
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "TrieCorrections.h"
+#include "LotSimilitude.h"
+#include "MeilleursCandidats.h"
+#include "FichierMappe.h"
+#include "TableChaines.h"
+#include "MotCompact.h"
+#include "VueTraductions.h"
+#include "CacheCorrections.h"
+#include "BorneParcours.h"
+
 namespace TP2P1
 {
+class LotDictionnaire;
+
 /**
 * \class Dictionnaire
 *
@@ -30,6 +43,8 @@ class Dictionnaire
 {
 public:
 
+	typedef std::pair<std::string_view, std::string_view> Paire;	// Un mot et l'une de ses traductions
+
 	/*
 	*\brief		Constructeur 
 	*
@@ -51,6 +66,19 @@ public:
 	*/
 	Dictionnaire(std::ifstream &fichier);
 
+	/*
+	*\brief		Constructeur de dictionnaire  partir d'un fichier projet en mmoire
+	*			Les lignes sont dcoupes directement dans la projection, sans copie ni limite de longueur
+	*
+	*\pre		Il y a suffisament de mmoire
+	*
+	*\post		Si le fichier est ouvert, l'instance de la classe a t initialise  partir du fichier de dictionnaire. Sinon, on gnre une classe vide.
+	*
+	*\exception	bad_alloc s'il n'y a pas assez de mmoire
+	*
+	*/
+	explicit Dictionnaire(const FichierMappe &fichier);
+
 
 	/*
 	*\brief		Destructeur
@@ -85,6 +113,29 @@ public:
 	*/
 	void supprimeMot(const std ::string& motOriginal);
 
+	/*
+	*\brief		Ajouter d'un coup tous les mots d'un lot (fichiers supplmentaires, glossaire, mise  jour)
+	*			Le lot, dj dcoup et tri, est fusionn en une passe avec les mots en ordre de l'arbre,
+	*			qui est ensuite rebranch parfaitement quilibr: O(n + k). Un petit lot est insr mot par mot
+	*
+	*\post		Les mots du lot sont dans le dictionnaire; les traductions d'un mot dj prsent sont ajoutes
+	*\post		 la suite des siennes. Le lot peut ensuite tre dtruit
+	*
+	*\exception	length_error si un mot aurait plus de MAX_TRADUCTIONS traductions; rien n'est alors modifi
+	*\exception	bad_alloc s'il n'y a pas assez de mmoire
+	*
+	*/
+	void fusionner(const LotDictionnaire &lot);
+
+	/*
+	*\brief		Dcouper le texte d'un fichier de dictionnaire en paires (mot, traduction)
+	*			Les paires pointent dans le texte, sans copie; elles sont dans l'ordre du texte
+	*
+	*\post		Les paires du texte sont ajoutes  la fin de paires. Les lignes d'en-tte (#) et les lignes sans traduction sont ignores
+	*
+	*/
+	static void analyserTexte(std::string_view texte, std::vector<Paire> &paires);
+
 	/*
 	*\brief		Quantifier la similitude entre 2 mots (dans le dictionnaire ou pas)
 	*			Ici, 1 reprsente le fait que les 2 mots sont identiques, 0 reprsente le fait que les 2 mots sont compltements diffrents
@@ -93,19 +144,46 @@ public:
 	*\post		On retourne une valeur entre 0 et 1 quantifiant la similarit entre les 2 mots donns
 	*
 	*/
-	double similitude(const std ::string& mot1, const std ::string& mot2);
+	double similitude(const std ::string& mot1, const std ::string& mot2) const;
+
+	/*
+	*\brief		Mme calcul que similitude(), sur des vues: aucune copie des mots ni allocation
+	*
+	*\post		Le dictionnaire est inchange.
+	*\post		On retourne exactement la mme valeur que la version sur std::string
+	*
+	*/
+	double similitude(std::string_view mot1, std::string_view mot2) const;
+
+	/*
+	*\brief		Quantifier la similitude entre un mot et chacun des mots d'une liste
+	*			Les comparaisons de lettres se font par instructions vectorielles (SSE2 ou AVX2) si le processeur le permet
+	*
+	*\post		Le dictionnaire est inchange.
+	*\post		La case i du rsultat vaut similitude(candidats[i], requete)
+	*
+	*/
+	std::vector<double> similitudeLot(const std::string& requete, const std::vector<std::string>& candidats) const;
 
 
 	/*
 	*\brief		Suggre des corrections pour le mot motMalEcrit sous forme d'une liste de mots, dans un vector,  partir du dictionnaire
+	*			Les mots les plus proches au sens de la distance d'dition sont cherchs dans l'index (trie) du dictionnaire,
+	*			sans parcourir tout l'arbre. Si l'index ne trouve rien d'assez proche, on compare avec tous les mots
+	*			et on garde ceux dont la similitude dpasse le seuil.
 	*
 	*\pre		Le dictionnaire n'est pas vide
 	*
-	*\post		S'il y a suffisament de mots, on redonne 10 corrections possibles au mot donn. Sinon, on en donne le plus possible
+	*\post		S'il y a suffisament de mots, on redonne nbCorrections (10 par dfaut) corrections possibles au mot donn. Sinon, on en donne le plus possible
+	*\post		Les corrections sont en ordre, de la meilleure  la moins bonne;  galit, en ordre alphabtique
+	*\post		Le rsultat est le mme quel que soit le nombre de threads utiliss pour le parcours complet
+	*\post		Si le cache des corrections est actif, le rsultat d'un mot dj corrig est repris sans recherche
+	*\post		DictionnaireFige::suggereCorrections() donne les mmes corrections pour les mmes mots
 	*
 	*\exception	logic_error si le dictionnaire est vide
 	*/
-	std::vector<std::string> suggereCorrections(const std ::string& motMalEcrit);
+	std::vector<std::string> suggereCorrections(const std ::string& motMalEcrit, unsigned int nbCorrections = NB_CORRECTIONS,
+	                                            double seuil = SEUIL_SIMILITUDE);
 
 	/*
 	*\brief		Trouver les traductions possibles d'un mot
@@ -115,7 +193,34 @@ public:
 	*\post		Le dictionnaire reste inchange
 	*
 	*/
-	std::vector<std::string> traduit(const std ::string& mot);
+	std::vector<std::string> traduit(const std ::string& mot) const;
+
+	/*
+	*\brief		Trouver les traductions possibles d'un mot, sans les copier
+	*
+	*\post		Si le mot appartient au dictionnaire, la vue donne ses traductions et trouve() est vrai.
+	*\post		Sinon, la vue est vide et trouve() est faux
+	*\post		La vue reste valide jusqu' la prochaine modification du dictionnaire
+	*
+	*/
+	VueTraductions vueTraductions(std::string_view mot) const;
+
+	/*
+	*\brief		Traduire une phrase mot  mot, sans interaction
+	*			Chaque mot est remplac par sa premire traduction, ou gard tel quel s'il est introuvable
+	*
+	*\post		On retourne la phrase traduite; chaque mot diffrent n'est cherch qu'une fois
+	*
+	*/
+	std::string traduirePhrase(std::string_view phrase) const;
+
+	/*
+	*\brief		Traduire un texte entier mot  mot et l'crire au fur et  mesure dans sortie
+	*
+	*\post		sortie contient le texte traduit
+	*
+	*/
+	void traduireTexte(std::string_view texte, std::ostream &sortie) const;
 
 	/*
 	*\brief		Vrifier si le mot donn appartient au dictionnaire
@@ -124,7 +229,7 @@ public:
 	*\post		On retourne true si le mot est dans le dictionnaire. Sinon, on retourne false.
 	*
 	*/
-	bool appartient(const std::string &data);
+	bool appartient(const std::string &data) const;
 
 	/*
 	*\brief		Vrifier si le dictionnaire est vide
@@ -134,72 +239,242 @@ public:
 	*/
 	bool estVide() const;
 
+	/*
+	*\brief		Choisir le nombre de threads utiliss pour comparer avec tous les mots dans suggereCorrections()
+	*			0 veut dire un thread par coeur du processeur; 1 (par dfaut) garde le parcours squentiel
+	*
+	*\post		Les prochains appels  suggereCorrections() utilisent nb threads
+	*
+	*/
+	void fixerNbThreads(unsigned int nb);
+
+	/*
+	*\brief		Choisir le nombre de mots mal crits dont les corrections sont gardes (cache LRU)
+	*			0 (par dfaut) dsactive le cache. Le cache est vid ds qu'un mot est ajout ou supprim
+	*
+	*\post		Les prochains appels  suggereCorrections() gardent au plus nb rsultats
+	*
+	*/
+	void fixerTailleCacheCorrections(size_t nb);
+
+	/*
+	*\brief		Donne le nombre d'appels  suggereCorrections() servis par le cache des corrections
+	*
+	*/
+	unsigned long long nbSuccesCacheCorrections() const;
+
+	/*
+	*\brief		Donne le nombre d'appels  suggereCorrections() que le cache des corrections n'a pas pu servir
+	*
+	*/
+	unsigned long long nbEchecsCacheCorrections() const;
+
+	/*
+	*\brief		Vrifier la structure de tout l'arbre (pour le dbogage)
+	*			Les mots sont en ordre strictement croissant, chaque hauteur est exacte,
+	*			chaque noeud est quilibr (facteur d'au plus 1) et le compte des mots est exact
+	*
+	*\post		Le dictionnaire est inchang
+	*
+	*\exception	logic_error  la premire proprit non respecte
+	*/
+	void verifierInvariants() const;
+
+	class Parcours;	// Un parcours en ordre d'une partie des mots
+
+	/*
+	*\brief		Parcourir en ordre les mots qui commencent par un prfixe (compltion)
+	*			On descend jusqu'au premier mot au moins gal au prfixe, puis on avance en ordre: O(log n + k)
+	*
+	*\post		Le parcours donne au plus limite mots, en ordre alphabtique
+	*\post		Le parcours reste valide jusqu' la prochaine modification du dictionnaire
+	*
+	*/
+	Parcours motsAvecPrefixe(std::string_view prefixe, size_t limite) const;
+
+	/*
+	*\brief		Parcourir en ordre les mots de l'intervalle [debut, fin)
+	*
+	*\post		Le parcours donne les mots m tels que debut <= m < fin, en ordre alphabtique
+	*\post		Le parcours reste valide jusqu' la prochaine modification du dictionnaire
+	*
+	*/
+	Parcours plage(std::string_view debut, std::string_view fin) const;
+
 
 private:
 
+	friend class DictionnaireFige;	// Parcourt l'arbre pour en faire une copie compacte
+
+   typedef uint32_t elem;	// L'indice d'un noeud dans le pool; 0 tient lieu de pointeur nul
+
+	// Un noeud occupe 32 octets: deux noeuds par ligne de cache
 	class NoeudDictionnaire
 	{
 	public:
 
-		std::string mot;						// Un mot (en anglais)
+		MotCompact mot;							// Un mot (en anglais), dans le noeud s'il est court
+
+		uint32_t debutTraductions;				// Le dbut, dans listes, des identifiants des diffrentes traductions possibles
+												// en franais du mot en anglais. Par exemple, la liste franaise
+												// { "contempler", "envisager" et "prvoir" } pourrait servir de traduction
+												// du mot anglais "contemplate".
 
-		std::vector<std::string> traductions;	// Les diffrentes traductions possibles en franais du mot en anglais
-												// Par exemple, la liste franaise { "contempler", "envisager" et "prvoir" }
-												// pourrait servir de traduction du mot anglais "contemplate".
+	    elem gauche, droite;					// Les enfants du noeud
 
-	    NoeudDictionnaire *gauche, *droite;		// Les enfants du noeud
+	    uint16_t nbTraductions;					// Le nombre de traductions  partir de debutTraductions
 
-	    int hauteur;							// La hauteur de ce noeud (afin de maintenir l'quilibre de l'arbre AVL)
+	    int8_t hauteur;							// La hauteur de ce noeud (afin de maintenir l'quilibre de l'arbre AVL)
 
 		// Vous pouvez ajouter ici un constructeur de NoeudDictionnaire
-		NoeudDictionnaire( const std::string&motOriginal,const std::string&motTraduit ): mot( motOriginal ), gauche( 0 ), droite( 0 ), hauteur(0) {traductions.push_back(motTraduit); }
+		NoeudDictionnaire( std::string_view motOriginal,uint32_t debut ): mot( motOriginal ), debutTraductions( debut ), gauche( 0 ), droite( 0 ), nbTraductions(1), hauteur(0) {}
 	};
 
-   typedef NoeudDictionnaire * elem;
+	/**
+	* \class PoolNoeuds
+	*
+	* \brief Rserve de noeuds rangs dans un seul vecteur et dsigns par leur indice
+	*
+	*  Les enfants d'un noeud sont des indices de 32 bits plutt que des pointeurs. Un noeud libr
+	*  est chan, par son enfant gauche, dans une liste de rutilisation. La case 0 n'est jamais
+	*  donne: l'indice 0 tient lieu de pointeur nul.
+	*
+	*  Le vecteur peut tre dplac par allouer(): une rfrence  un noeud, ou  l'un de ses liens,
+	*  n'est valide que jusqu'au prochain allouer(), sauf si la place a d'abord t rserve.
+	*/
+	class PoolNoeuds
+	{
+	public:
+
+		PoolNoeuds();
+
+		/*
+		*\brief		Construire un noeud dans le pool (un noeud libr est rutilis en priorit)
+		*
+		*\exception	bad_alloc s'il n'y a pas assez de mmoire
+		*\exception	length_error si le pool contient dj UINT32_MAX noeuds
+		*/
+		elem allouer(std::string_view motOriginal, uint32_t debutTraductions);
+
+		/*
+		*\brief		Librer le mot d'un noeud et garder sa place pour un prochain allouer()
+		*/
+		void liberer(elem noeud);
+
+		/*
+		*\brief		S'assurer que les nb prochains allouer() ne dplaceront pas le vecteur
+		*
+		*\exception	bad_alloc s'il n'y a pas assez de mmoire
+		*/
+		void reserver(size_t nb);
+
+		NoeudDictionnaire & operator[](elem noeud);
+
+		const NoeudDictionnaire & operator[](elem noeud) const;
+
+	private:
+
+		std::vector<NoeudDictionnaire> noeuds;	// Tous les noeuds, libres ou non; noeuds[0] n'est jamais utilis
+
+		elem libres;				// La liste des places libres, prtes  tre rutilises
+
+		size_t nbLibres;			// Le nombre de places dans libres
+
+		// Le pool possde sa mmoire: il ne se copie pas
+		PoolNoeuds(const PoolNoeuds &);
+		PoolNoeuds & operator=(const PoolNoeuds &);
+	};
 
    elem racine;			// La racine de l'arbre des mots
 
    int cpt;				// Le nombre de mots dans le dictionnaire
 
+   PoolNoeuds pool;		// La mmoire de tous les noeuds de l'arbre
+
+   TableChaines chaines;	// Les traductions, chacune garde une seule fois pour tout le dictionnaire
+
+   std::vector<uint32_t> listes;	// Les identifiants des traductions de tous les mots; chaque noeud en dsigne un intervalle
+
+   size_t listesPerdues;	// Le nombre de cases de listes qu'aucun noeud ne dsigne plus
+
+   TrieCorrections index;	// Les mots du dictionnaire, indexs pour la correction
+
+   unsigned int nbThreads;	// Le nombre de threads du parcours complet de suggereCorrections()
+
+   CacheCorrections cacheCorrections;	// Les corrections des derniers mots mal crits
+
+   static const unsigned int NB_CORRECTIONS = 10;	// Le nombre de corrections suggres par dfaut
+
+   static constexpr double SEUIL_SIMILITUDE = .4;	// La similitude minimale par dfaut lors du parcours complet
+
+   static const unsigned int DISTANCE_MAX = 3;		// La distance d'dition maximale cherche dans l'index
+
+   static const size_t TAILLE_LOT = 256;		// Le nombre de mots nots ensemble lors du parcours complet
+
+   static const int TAILLE_MIN_PARALLELE = 16384;	// Sous ce nombre de mots, le parcours complet reste squentiel
+
+   static const size_t SOUS_ARBRES_PAR_THREAD = 8;	// Le nombre de sous-arbres  se partager, par thread
+
+   std::vector<elem *> chemin;	// Les liens traverss par la dernire insertion ou le dernier retrait, gards pour ne pas rallouer
+
+   static const uint16_t MAX_TRADUCTIONS = UINT16_MAX;	// Le nombre maximal de traductions d'un mot
+
+   static const size_t RAPPORT_FUSION = 16;	// Un lot de moins de cpt / RAPPORT_FUSION paires est insr mot par mot
+
    //Vous pouvez ajouter autant de mthodes prives que vous voulez
-   std::vector<std::string> & _auxTraduit( elem & arbre,const std::string& mot);
 
    /*
-	*\brief		Vrifier rcursivement pour une corrections
+	*\brief		Chercher des corrections en comparant avec tous les mots de l'arbre
+	*			Les mots sont nots par lots de TAILLE_LOT avec LotSimilitude
 	*
 	*\post		Le dictionnaire est inchang
+	*\post		Chaque mot a t propos  la slection avec son score
 	*
 	*/
-   void _auxsuggereCorrections( elem & arbre,const std::string& motMalEcrit,double& min,std::vector<std::string> &corrections);
+   void _auxsuggereCorrections( elem arbre,const std::string& motMalEcrit,MeilleursCandidats &meilleurs) const;
+
+   /*
+	*\brief		Comparer avec tous les mots de l'arbre en parallle
+	*			Le haut de l'arbre est dcoup en sous-arbres disjoints que les threads se partagent;
+	*			chaque thread garde ses propres meilleurs candidats, fusionns  la fin
+	*
+	*\post		Le dictionnaire est inchang
+	*\post		meilleurs contient la mme slection qu'avec _auxsuggereCorrections(racine, ...)
+	*
+	*/
+   void _suggereCorrectionsParallele(const std::string& motMalEcrit, unsigned int nb, MeilleursCandidats &meilleurs) const;
 
 
    /*
-	*\brief		Vrifier rcursivement pour un mot dans le dictionnaire
+	*\brief		Chercher un mot dans le dictionnaire, par une boucle
 	*
+	*\post		On retourne le noeud du mot, ou 0 s'il n'y est pas
 	*\post		Le dictionnaire est inchang
 	*
 	*/
-   elem _auxAppartient(elem arbre, const std::string &mot) const;
+   elem _auxAppartient(elem arbre, std::string_view mot) const;
    
 
    /*
-	*\brief		Vrifier rcursivement pour enlever un mot dans le dfictionnaire
+	*\brief		Enlever un mot du dictionnaire, sans rcursion, et rquilibrer l'arbre AVL
+	*			Un noeud  deux enfants prend le mot et les traductions de son successeur, qui est retir  sa place.
+	*			En remontant le chemin, on s'arrte ds qu'une hauteur ne change pas
 	*
-	*\post		L'lment est retir du dictionnaire
+	*\post		L'lment est retir du dictionnaire et l'arbre est quilibr
 	*
 	*/
    void _auxEnlever( elem &, const std::string&);
 
      /*
-	*\brief		Retirer le plus petit lment du dictionnaire
+	*\brief		Rquilibrer un noeud aprs un retrait dans l'un de ses sous-arbres
 	*
-	*\post		L'lment est retir du dictionnaire
+	*\post		Le sous-arbre est quilibr et sa hauteur est  jour
 	*
 	*/
-   void _auxRetireMin( elem & arbre) const;
+   void _equilibrer( elem & noeud);
 
     /*
-	*\brief		Dtruire le dictionnaire
+	*\brief		Dtruire le dictionnaire, sans rcursion
 	*
 	*\post		Le dictionnaire est dtruit.
 	*
@@ -208,20 +483,107 @@ private:
 
      /*
 	*\brief		Charger un dictionnaire avec un fichier texte
+	*			Le fichier est lu d'un bloc, puis dcoup par chargerTexte()
 	*
 	*\post		Le dictionnaire est charg
 	*
 	*/
    void chargerDictionnaire(std::ifstream &fichierEntree);
 
+     /*
+	*\brief		Charger un dictionnaire  partir du texte complet du fichier
+	*			Chaque ligne est dcoupe sur place; seuls les mots insrs dans l'arbre sont copis
+	*
+	*			Les paires (mot, traduction) sont d'abord toutes recueillies; si le dictionnaire est vide,
+	*			l'arbre est ensuite construit d'un coup par _construireEquilibre()
+	*
+	*\post		Le dictionnaire est charg. Les lignes d'en-tte (#) et les lignes sans traduction sont ignores
+	*
+	*/
+   void chargerTexte(std::string_view texte);
+
+     /*
+	*\brief		Construire l'arbre d'un coup  partir de toutes les paires (mot, traduction)
+	*			Les paires sont tries seulement si elles ne sont pas dj en ordre; l'arbre est ensuite
+	*			bti en O(N), le mot du milieu de chaque intervalle en tant la racine, sans rotation
+	*
+	*\pre		Le dictionnaire est vide
+	*
+	*\post		L'arbre contient tous les mots, quilibr, avec leurs traductions dans l'ordre du fichier
+	*
+	*/
+   void _construireEquilibre(std::vector<Paire> &paires);
+
+     /*
+	*\brief		Btir rcursivement le sous-arbre des mots [debut, fin) de la liste
+	*
+	*\post		On retourne la racine du sous-arbre; les hauteurs sont  jour
+	*
+	*/
+   elem _auxConstruire(const std::vector<Paire> &paires, const std::vector<size_t> &groupes, size_t debut, size_t fin);
+
+     /*
+	*\brief		Fusionner des paires tries avec les mots de l'arbre et rebrancher l'arbre quilibr
+	*			Les noeuds existants sont gards; seuls les liens et les hauteurs changent
+	*
+	*\pre		Les paires sont tries par mot, les traductions d'un mot dans l'ordre o les ajouter
+	*\pre		_verifierLot(paires) a accept le lot et donn nouveaux
+	*
+	*\post		L'arbre contient aussi les mots des paires, parfaitement quilibr
+	*
+	*/
+   void _fusionnerTrie(const std::vector<Paire> &paires, size_t nouveaux);
+
+     /*
+	*\brief		Vrifier qu'aucun mot d'un lot n'aurait plus de MAX_TRADUCTIONS traductions
+	*
+	*\pre		Les paires sont tries par mot
+	*
+	*\post		On retourne le nombre de mots du lot absents de l'arbre
+	*\post		Le dictionnaire est inchang
+	*
+	*\exception	length_error si un mot aurait trop de traductions
+	*
+	*/
+   size_t _verifierLot(const std::vector<Paire> &paires) const;
+
+     /*
+	*\brief		Rebrancher rcursivement les noeuds [debut, fin), donns en ordre, en un sous-arbre quilibr
+	*
+	*\post		On retourne la racine du sous-arbre; les hauteurs sont  jour
+	*
+	*/
+   elem _auxRelier(const std::vector<elem> &noeuds, size_t debut, size_t fin);
+
+     /*
+	*\brief		Ajouter une traduction  la fin de l'intervalle d'un noeud
+	*			Si l'intervalle n'est pas  la fin de listes, il y est d'abord recopi
+	*
+	*\post		La traduction est la dernire du noeud
+	*
+	*\exception	length_error si le noeud a dj MAX_TRADUCTIONS traductions
+	*
+	*/
+   void _ajouterTraduction(NoeudDictionnaire &noeud, uint32_t traduction);
 
      /*
-	*\brief		Insrer un lment rcursivement
+	*\brief		Recopier les intervalles de tous les noeuds, en ordre, dans une nouvelle liste sans cases perdues
+	*
+	*\post		listesPerdues == 0
+	*
+	*/
+   void _compacterListes();
+
+
+     /*
+	*\brief		Insrer un lment sans rcursion
+	*			Les liens traverss sont gards dans chemin; en remontant, on s'arrte ds qu'une
+	*			rotation a t faite ou qu'une hauteur ne change pas
 	*
 	*\post		L'lment est insr
 	*
 	*/
-   void _auxInserer( elem &, const std::string&,const std::string&);
+   void _auxInserer( elem &, std::string_view, std::string_view);
 
 
       /*
@@ -270,6 +632,51 @@ private:
 	void _zigZagDroit(elem &);
 };
 
+/**
+* \class Dictionnaire::Parcours
+*
+* \brief Donne un  un, en ordre, les mots d'une partie du dictionnaire
+*
+*  La pile garde les noeuds dont il reste  visiter le mot et le sous-arbre droit; elle ne
+*  dpasse jamais la hauteur de l'arbre et est alloue une seule fois. Les mots sont donns
+*  sans copie.
+*/
+class Dictionnaire::Parcours
+{
+public:
+
+	/*
+	*\brief		Passer au mot suivant
+	*
+	*\post		On retourne false si le parcours est termin. Sinon, mot est le mot suivant
+	*
+	*/
+	bool suivant(std::string_view &mot);
+
+	/*
+	*\brief		Donne les traductions du dernier mot donn par suivant()
+	*
+	*/
+	VueTraductions traductions() const;
+
+private:
+
+   friend class Dictionnaire;
+
+   /*
+	*\brief		Descendre jusqu'au premier mot au moins gal  debut
+	*/
+   Parcours(const Dictionnaire &dico, std::string_view debut, const BorneParcours &borne);
+
+   const Dictionnaire * dico;	// Le dictionnaire parcouru
+
+   std::vector<elem> pile;		// Les noeuds  visiter, le prochain au sommet
+
+   elem courant;				// Le noeud du dernier mot donn, ou 0
+
+   BorneParcours borne;		// L'arrt du parcours
+};
+
 }
 
 #endif /* DICO_H_ */
@@ -0,0 +1,585 @@
+/**
+ * \file DictionnaireFige.cpp
+ * \brief Ce fichier contient une implantation des mthodes de la classe DictionnaireFige
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+#include "DictionnaireFige.h"
+#include "LotSimilitude.h"
+#include "MeilleursCandidats.h"
+#include "TraducteurTexte.h"
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+namespace TP2P1
+{
+
+	/**
+	 * \fn DictionnaireFige::DictionnaireFige(const Dictionnaire &dico)
+	 * \param[in] dico : Dictionnaire  copier
+	 */
+	DictionnaireFige::DictionnaireFige(const Dictionnaire &dico)
+	{
+		std::vector<const Dictionnaire::NoeudDictionnaire *> noeuds;
+		noeuds.reserve(dico.cpt);
+		_auxParcourir(dico, dico.racine, noeuds);
+
+		//On calcule la taille de chaque table avant de tout placer dans le tampon
+		size_t tailleMots = 0, nbTraductions = 0, tailleTraductions = 0;
+		for (size_t i = 0; i < noeuds.size(); i++)
+		{
+			tailleMots += noeuds[i]->mot.size();
+			nbTraductions += noeuds[i]->nbTraductions;
+			for (size_t j = 0; j < noeuds[i]->nbTraductions; j++)
+				tailleTraductions += dico.chaines.chaine(dico.listes[noeuds[i]->debutTraductions + j]).size();
+		}
+		if (tailleMots > UINT32_MAX || tailleTraductions > UINT32_MAX || nbTraductions >= UINT32_MAX)
+			throw std::length_error("DictionnaireFige: le dictionnaire est trop gros\n");
+
+		nbMots = static_cast<uint32_t>(noeuds.size());
+		this->nbTraductions = static_cast<uint32_t>(nbTraductions);
+		this->tailleMots = static_cast<uint32_t>(tailleMots);
+		this->tailleTraductions = static_cast<uint32_t>(tailleTraductions);
+		size_t octets = _octetsTampon(nbMots, this->nbTraductions, this->tailleMots, this->tailleTraductions);
+		image.assign((octets + sizeof(uint64_t) - 1) / sizeof(uint64_t), 0);
+		tampon = image.empty() ? 0 : &image[0];
+		tailleTampon = image.size();
+		_placerTables();
+
+		//Les tables sont remplies en passant par des pointeurs modifiables
+		uint64_t * tPrefixes = const_cast<uint64_t *>(prefixes);
+		uint32_t * tDebutMots = const_cast<uint32_t *>(debutMots);
+		uint32_t * tDebutListes = const_cast<uint32_t *>(debutListes);
+		uint32_t * tDebutTraductions = const_cast<uint32_t *>(debutTraductions);
+		char * tMots = const_cast<char *>(reserveMots);
+		char * tTraductions = const_cast<char *>(reserveTraductions);
+
+		uint32_t posMot = 0, posTraduction = 0, t = 0;
+		for (uint32_t i = 0; i < nbMots; i++)
+		{
+			std::string_view mot = noeuds[i]->mot.vue();
+			tPrefixes[i] = _prefixe(mot.data(), mot.size());
+			tDebutMots[i] = posMot;
+			memcpy(tMots + posMot, mot.data(), mot.size());
+			posMot += static_cast<uint32_t>(mot.size());
+
+			tDebutListes[i] = t;
+			for (size_t j = 0; j < noeuds[i]->nbTraductions; j++, t++)
+			{
+				std::string_view traduction = dico.chaines.chaine(dico.listes[noeuds[i]->debutTraductions + j]);
+				tDebutTraductions[t] = posTraduction;
+				memcpy(tTraductions + posTraduction, traduction.data(), traduction.size());
+				posTraduction += static_cast<uint32_t>(traduction.size());
+			}
+		}
+		tDebutMots[nbMots] = posMot;
+		tDebutListes[nbMots] = t;
+		tDebutTraductions[t] = posTraduction;
+	}
+
+	/**
+	 * \fn DictionnaireFige::DictionnaireFige(const FichierMappe &fichier)
+	 * \param[in] fichier : Fichier qui contient l'image
+	 */
+	DictionnaireFige::DictionnaireFige(const FichierMappe &fichier)
+	{
+		std::string_view contenu = fichier.contenu();
+		if (!estImage(contenu))
+			throw std::runtime_error("DictionnaireFige: le fichier n'est pas une image de dictionnaire\n");
+
+		EnteteImage entete;
+		memcpy(&entete, contenu.data(), sizeof(entete));
+		if (entete.ordreOctets != ORDRE_OCTETS || entete.version != VERSION_IMAGE)
+			throw std::runtime_error("DictionnaireFige: version ou boutisme de l'image non support\n");
+
+		//Les tailles annonces doivent correspondre exactement  celle du fichier
+		size_t octets = _octetsTampon(entete.nbMots, entete.nbTraductions, entete.tailleMots, entete.tailleTraductions);
+		size_t taille = (octets + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+		if (entete.tailleTampon != taille || contenu.size() != sizeof(entete) + taille * sizeof(uint64_t))
+			throw std::runtime_error("DictionnaireFige: image tronque ou corrompue\n");
+
+		nbMots = entete.nbMots;
+		nbTraductions = entete.nbTraductions;
+		tailleMots = entete.tailleMots;
+		tailleTraductions = entete.tailleTraductions;
+		tampon = taille == 0 ? 0 : reinterpret_cast<const uint64_t *>(contenu.data() + sizeof(entete));
+		tailleTampon = taille;
+		_placerTables();
+
+		if (debutMots[nbMots] != tailleMots || debutListes[nbMots] != nbTraductions
+		    || debutTraductions[nbTraductions] != tailleTraductions)
+			throw std::runtime_error("DictionnaireFige: image tronque ou corrompue\n");
+	}
+
+	/**
+	 * \fn void DictionnaireFige::sauvegarder(const std::string &nomFichier) const
+	 * \param[in] nomFichier : Le fichier  crire
+	 */
+	void DictionnaireFige::sauvegarder(const std::string &nomFichier) const
+	{
+		EnteteImage entete;
+		memset(&entete, 0, sizeof(entete));
+		memcpy(entete.magie, "TP2DICO", 8);
+		entete.version = VERSION_IMAGE;
+		entete.ordreOctets = ORDRE_OCTETS;
+		entete.nbMots = nbMots;
+		entete.nbTraductions = nbTraductions;
+		entete.tailleMots = tailleMots;
+		entete.tailleTraductions = tailleTraductions;
+		entete.tailleTampon = tailleTampon;
+		entete.somme = _somme(tampon, tailleTampon);
+
+		std::ofstream sortie(nomFichier.c_str(), std::ios::binary | std::ios::trunc);
+		sortie.write(reinterpret_cast<const char *>(&entete), sizeof(entete));
+		if (tailleTampon != 0)
+			sortie.write(reinterpret_cast<const char *>(tampon), tailleTampon * sizeof(uint64_t));
+		sortie.close();
+		if (!sortie)
+			throw std::runtime_error("DictionnaireFige: impossible d'crire l'image\n");
+	}
+
+	/**
+	 * \fn bool DictionnaireFige::verifierSomme() const
+	 *
+	 * Pour une image construite en mmoire, il n'y a pas d'en-tte: le tampon est toujours intact.
+	 */
+	bool DictionnaireFige::verifierSomme() const
+	{
+		if (!image.empty() || tampon == 0)
+			return true;
+
+		const EnteteImage * entete = reinterpret_cast<const EnteteImage *>(tampon) - 1;
+		return entete->somme == _somme(tampon, tailleTampon);
+	}
+
+	/**
+	 * \fn bool DictionnaireFige::estImage(std::string_view contenu)
+	 * \param[in] contenu : Le contenu d'un fichier
+	 */
+	bool DictionnaireFige::estImage(std::string_view contenu)
+	{
+		return contenu.size() >= sizeof(EnteteImage) && memcmp(contenu.data(), "TP2DICO", 8) == 0;
+	}
+
+	/**
+	 * \fn std::vector<std::string> DictionnaireFige::traduit(const std::string& mot) const
+	 * \param[in] mot : Mot  traduire.
+	 */
+	std::vector<std::string> DictionnaireFige::traduit(const std::string& mot) const
+	{
+		std::vector<std::string> traductions;
+		uint32_t i = _chercher(mot);
+		if (i == nbMots)
+			return traductions;
+
+		traductions.reserve(debutListes[i + 1] - debutListes[i]);
+		for (uint32_t t = debutListes[i]; t < debutListes[i + 1]; t++)
+			traductions.push_back(std::string(reserveTraductions + debutTraductions[t],
+			                                  debutTraductions[t + 1] - debutTraductions[t]));
+		return traductions;
+	}
+
+	/**
+	 * \fn VueTraductions DictionnaireFige::vueTraductions(std::string_view mot) const
+	 * \param[in] mot : Mot  traduire.
+	 */
+	VueTraductions DictionnaireFige::vueTraductions(std::string_view mot) const
+	{
+		uint32_t i = _chercher(mot);
+		if (i == nbMots)
+			return VueTraductions();
+		return VueTraductions(reserveTraductions, debutTraductions + debutListes[i], debutListes[i + 1] - debutListes[i]);
+	}
+
+	/**
+	 * \fn std::string DictionnaireFige::traduirePhrase(std::string_view phrase) const
+	 * \param[in] phrase : Phrase  traduire
+	 */
+	std::string DictionnaireFige::traduirePhrase(std::string_view phrase) const
+	{
+		return TraducteurTexte<DictionnaireFige>(*this).traduirePhrase(phrase);
+	}
+
+	/**
+	 * \fn void DictionnaireFige::traduireTexte(std::string_view texte, std::ostream &sortie) const
+	 * \param[in] texte : Texte  traduire
+	 * \param[out] sortie : Flot o crire la traduction
+	 */
+	void DictionnaireFige::traduireTexte(std::string_view texte, std::ostream &sortie) const
+	{
+		TraducteurTexte<DictionnaireFige>(*this).traduireTexte(texte, sortie);
+	}
+
+	/**
+	 * \fn bool DictionnaireFige::appartient(const std::string &mot) const
+	 * \param[in] mot : Mot  vrifier
+	 */
+	bool DictionnaireFige::appartient(const std::string &mot) const
+	{
+		return _chercher(mot) != nbMots;
+	}
+
+	/**
+	 * \fn std::vector<std::string> DictionnaireFige::suggereCorrections(const std::string& motMalEcrit, unsigned int nbCorrections, double seuil) const
+	 * \param[in] motMalEcrit : Mot  corriger
+	 * \param[in] nbCorrections : Nombre maximal de corrections
+	 * \param[in] seuil : Similitude  dpasser lors du parcours complet
+	 */
+	std::vector<std::string> DictionnaireFige::suggereCorrections(const std::string& motMalEcrit, unsigned int nbCorrections,
+	                                                              double seuil) const
+	{
+		if (nbCorrections == 0)
+			return std::vector<std::string>();
+
+		//Les mots  distance d'dition d'au plus DISTANCE_MAX, en une passe, compts par distance
+		std::vector<std::pair<unsigned int, std::string_view> > proches;
+		size_t parDistance[Dictionnaire::DISTANCE_MAX + 1] = {};
+		std::vector<unsigned int> ligne;
+		for (uint32_t i = 0; i < nbMots; i++)
+		{
+			std::string_view mot(reserveMots + debutMots[i], debutMots[i + 1] - debutMots[i]);
+			unsigned int distance = _distanceBornee(motMalEcrit, mot, Dictionnaire::DISTANCE_MAX, ligne);
+			if (distance <= Dictionnaire::DISTANCE_MAX)
+			{
+				proches.push_back(std::make_pair(distance, mot));
+				parDistance[distance]++;
+			}
+		}
+
+		//Comme l'index de Dictionnaire: on largit d'une distance  la fois jusqu' avoir assez de mots
+		unsigned int distanceRetenue = 1;
+		size_t nbProches = parDistance[0] + parDistance[1];
+		while (distanceRetenue < Dictionnaire::DISTANCE_MAX && nbProches < nbCorrections)
+			nbProches += parDistance[++distanceRetenue];
+
+		if (nbProches == 0)
+			return _parcoursSimilitude(motMalEcrit, nbCorrections, seuil);
+
+		std::vector<std::string_view> mots;
+		std::vector<unsigned int> distances;
+		for (size_t i = 0; i < proches.size(); i++)
+		{
+			if (proches[i].first <= distanceRetenue)
+			{
+				distances.push_back(proches[i].first);
+				mots.push_back(proches[i].second);
+			}
+		}
+		std::vector<double> scores(mots.size());
+		LotSimilitude(motMalEcrit).noter(&mots[0], mots.size(), &scores[0]);
+
+		//Les plus proches d'abord;  distance gale le plus similaire, puis l'ordre alphabtique
+		std::vector<std::pair<std::pair<unsigned int, double>, std::string_view> > classement;
+		classement.reserve(mots.size());
+		for (size_t i = 0; i < mots.size(); i++)
+			classement.push_back(std::make_pair(std::make_pair(distances[i], -scores[i]), mots[i]));
+		std::sort(classement.begin(), classement.end());
+
+		std::vector<std::string> corrections;
+		for (size_t i = 0; i < classement.size() && i < nbCorrections; i++)
+			corrections.push_back(std::string(classement[i].second));
+		return corrections;
+	}
+
+	/**
+	 * \fn std::vector<std::string> DictionnaireFige::_parcoursSimilitude(const std::string& motMalEcrit, unsigned int nbCorrections, double seuil) const
+	 * \param[in] motMalEcrit : Mot  corriger
+	 * \param[in] nbCorrections : Nombre maximal de corrections
+	 * \param[in] seuil : Similitude  dpasser
+	 */
+	std::vector<std::string> DictionnaireFige::_parcoursSimilitude(const std::string& motMalEcrit, unsigned int nbCorrections,
+	                                                               double seuil) const
+	{
+		LotSimilitude lot(motMalEcrit);
+		MeilleursCandidats meilleurs(nbCorrections, seuil);
+		std::string_view mots[TAILLE_LOT];
+		double scores[TAILLE_LOT];
+
+		for (uint32_t debut = 0; debut < nbMots; debut += TAILLE_LOT)
+		{
+			size_t n = nbMots - debut < TAILLE_LOT ? nbMots - debut : TAILLE_LOT;
+			for (size_t k = 0; k < n; k++)
+				mots[k] = std::string_view(reserveMots + debutMots[debut + k], debutMots[debut + k + 1] - debutMots[debut + k]);
+
+			lot.noter(mots, n, scores);
+			for (size_t k = 0; k < n; k++)
+				meilleurs.proposer(scores[k], mots[k]);
+		}
+		return meilleurs.resultats();
+	}
+
+	/**
+	 * \fn unsigned int DictionnaireFige::_distanceBornee(std::string_view mot1, std::string_view mot2, unsigned int borne, std::vector<unsigned int> &ligne)
+	 * \param[in] mot1 : Premier mot
+	 * \param[in] mot2 : Deuxime mot
+	 * \param[in] borne : Distance au-del de laquelle on abandonne
+	 * \param[in,out] ligne : Espace de travail, rutilis d'un appel  l'autre
+	 */
+	unsigned int DictionnaireFige::_distanceBornee(std::string_view mot1, std::string_view mot2, unsigned int borne,
+	                                               std::vector<unsigned int> &ligne)
+	{
+		size_t ecart = mot1.size() > mot2.size() ? mot1.size() - mot2.size() : mot2.size() - mot1.size();
+		if (ecart > borne)
+			return borne + 1;
+
+		//ligne[i] : distance entre les j premires lettres de mot2 et les i premires lettres de mot1
+		ligne.resize(mot1.size() + 1);
+		for (size_t i = 0; i <= mot1.size(); i++)
+			ligne[i] = static_cast<unsigned int>(i);
+		for (size_t j = 1; j <= mot2.size(); j++)
+		{
+			unsigned int diagonale = ligne[0];
+			ligne[0] = static_cast<unsigned int>(j);
+			unsigned int minimum = ligne[0];
+			for (size_t i = 1; i <= mot1.size(); i++)
+			{
+				unsigned int dessus = ligne[i];
+				unsigned int distance = diagonale + (mot1[i - 1] == mot2[j - 1] ? 0 : 1);
+				if (dessus + 1 < distance)
+					distance = dessus + 1;
+				if (ligne[i - 1] + 1 < distance)
+					distance = ligne[i - 1] + 1;
+				diagonale = dessus;
+				ligne[i] = distance;
+				if (distance < minimum)
+					minimum = distance;
+			}
+			//Toute la ligne dpasse la borne: la distance finale aussi
+			if (minimum > borne)
+				return borne + 1;
+		}
+		return ligne[mot1.size()] <= borne ? ligne[mot1.size()] : borne + 1;
+	}
+
+	/**
+	 * \fn uint32_t DictionnaireFige::taille() const
+	 */
+	uint32_t DictionnaireFige::taille() const
+	{
+		return nbMots;
+	}
+
+	/**
+	 * \fn DictionnaireFige::Parcours DictionnaireFige::motsAvecPrefixe(std::string_view prefixe, size_t limite) const
+	 * \param[in] prefixe : Dbut commun des mots
+	 * \param[in] limite : Nombre maximal de mots
+	 */
+	DictionnaireFige::Parcours DictionnaireFige::motsAvecPrefixe(std::string_view prefixe, size_t limite) const
+	{
+		return Parcours(*this, _borneInferieure(prefixe), BorneParcours::prefixe(prefixe, limite));
+	}
+
+	/**
+	 * \fn DictionnaireFige::Parcours DictionnaireFige::plage(std::string_view debut, std::string_view fin) const
+	 * \param[in] debut : Premier mot possible
+	 * \param[in] fin : Premier mot exclu
+	 */
+	DictionnaireFige::Parcours DictionnaireFige::plage(std::string_view debut, std::string_view fin) const
+	{
+		return Parcours(*this, _borneInferieure(debut), BorneParcours::superieure(fin));
+	}
+
+	/**
+	 * \fn DictionnaireFige::Parcours::Parcours(const DictionnaireFige &dico, uint32_t debut, const BorneParcours &borne)
+	 * \param[in] dico : Dictionnaire parcouru
+	 * \param[in] debut : Indice du premier mot
+	 * \param[in] borne : Arrt du parcours
+	 */
+	DictionnaireFige::Parcours::Parcours(const DictionnaireFige &dico, uint32_t debut, const BorneParcours &borne)
+		: dico(&dico), indice(debut), courant(dico.nbMots), borne(borne)
+	{
+	}
+
+	/**
+	 * \fn bool DictionnaireFige::Parcours::suivant(std::string_view &mot)
+	 * \param[out] mot : Le mot suivant
+	 */
+	bool DictionnaireFige::Parcours::suivant(std::string_view &mot)
+	{
+		courant = dico->nbMots;
+		if (indice >= dico->nbMots)
+			return false;
+
+		std::string_view candidat(dico->reserveMots + dico->debutMots[indice],
+		                          dico->debutMots[indice + 1] - dico->debutMots[indice]);
+		if (!borne.accepte(candidat))
+		{
+			indice = dico->nbMots;
+			return false;
+		}
+
+		courant = indice++;
+		mot = candidat;
+		return true;
+	}
+
+	/**
+	 * \fn VueTraductions DictionnaireFige::Parcours::traductions() const
+	 */
+	VueTraductions DictionnaireFige::Parcours::traductions() const
+	{
+		if (courant >= dico->nbMots)
+			return VueTraductions();
+		return VueTraductions(dico->reserveTraductions, dico->debutTraductions + dico->debutListes[courant],
+		                      dico->debutListes[courant + 1] - dico->debutListes[courant]);
+	}
+
+	/**
+	 * \fn size_t DictionnaireFige::_octetsTampon(uint32_t nbMots, uint32_t nbTraductions, uint32_t tailleMots, uint32_t tailleTraductions)
+	 * \param[in] nbMots : Nombre de mots
+	 * \param[in] nbTraductions : Nombre de traductions
+	 * \param[in] tailleMots : Nombre de caractres des mots
+	 * \param[in] tailleTraductions : Nombre de caractres des traductions
+	 */
+	size_t DictionnaireFige::_octetsTampon(uint32_t nbMots, uint32_t nbTraductions, uint32_t tailleMots, uint32_t tailleTraductions)
+	{
+		return static_cast<size_t>(nbMots) * sizeof(uint64_t)
+		     + 2 * (static_cast<size_t>(nbMots) + 1) * sizeof(uint32_t)
+		     + (static_cast<size_t>(nbTraductions) + 1) * sizeof(uint32_t)
+		     + tailleMots + tailleTraductions;
+	}
+
+	/**
+	 * \fn void DictionnaireFige::_placerTables()
+	 *
+	 * Les tables d'entiers d'abord (alignes), les rserves de caractres ensuite.
+	 */
+	void DictionnaireFige::_placerTables()
+	{
+		const char * place = reinterpret_cast<const char *>(tampon);
+		prefixes = reinterpret_cast<const uint64_t *>(place);
+		place += nbMots * sizeof(uint64_t);
+		debutMots = reinterpret_cast<const uint32_t *>(place);
+		place += (nbMots + 1) * sizeof(uint32_t);
+		debutListes = reinterpret_cast<const uint32_t *>(place);
+		place += (nbMots + 1) * sizeof(uint32_t);
+		debutTraductions = reinterpret_cast<const uint32_t *>(place);
+		place += (nbTraductions + 1) * sizeof(uint32_t);
+		reserveMots = place;
+		place += tailleMots;
+		reserveTraductions = place;
+	}
+
+	/**
+	 * \fn uint64_t DictionnaireFige::_somme(const uint64_t * tampon, size_t taille)
+	 * \param[in] tampon : Le tampon
+	 * \param[in] taille : Son nombre d'entiers de 64 bits
+	 */
+	uint64_t DictionnaireFige::_somme(const uint64_t * tampon, size_t taille)
+	{
+		uint64_t somme = 0xcbf29ce484222325ULL;
+		for (size_t i = 0; i < taille; i++)
+			somme = (somme ^ tampon[i]) * 0x100000001b3ULL;
+		return somme;
+	}
+
+	/**
+	 * \fn void DictionnaireFige::_auxParcourir(const Dictionnaire &dico, Dictionnaire::elem arbre, std::vector<const Dictionnaire::NoeudDictionnaire *> &noeuds)
+	 * \param[in] dico : Le dictionnaire parcouru
+	 * \param[in] arbre : Noeud dans le dictionnaire
+	 * \param[out] noeuds : La liste  remplir
+	 */
+	void DictionnaireFige::_auxParcourir(const Dictionnaire &dico, Dictionnaire::elem arbre,
+	                                     std::vector<const Dictionnaire::NoeudDictionnaire *> &noeuds)
+	{
+		if (arbre == 0)
+			return;
+
+		const Dictionnaire::NoeudDictionnaire &noeud = dico.pool[arbre];
+		_auxParcourir(dico, noeud.gauche, noeuds);
+		noeuds.push_back(&noeud);
+		_auxParcourir(dico, noeud.droite, noeuds);
+	}
+
+	/**
+	 * \fn uint64_t DictionnaireFige::_prefixe(const char * mot, size_t longueur)
+	 * \param[in] mot : Caractres du mot
+	 * \param[in] longueur : Nombre de caractres
+	 *
+	 * Les octets sont placs du plus significatif au moins significatif: comparer deux prfixes
+	 * donne le mme ordre que comparer les mots (octets non signs, comme std::string).
+	 */
+	uint64_t DictionnaireFige::_prefixe(const char * mot, size_t longueur)
+	{
+		uint64_t prefixe = 0;
+		for (size_t i = 0; i < 8; i++)
+		{
+			prefixe <<= 8;
+			if (i < longueur)
+				prefixe |= static_cast<unsigned char>(mot[i]);
+		}
+		return prefixe;
+	}
+
+	/**
+	 * \fn int DictionnaireFige::_comparer(uint32_t indice, uint64_t prefixe, std::string_view mot) const
+	 * \param[in] indice : Indice du mot du dictionnaire
+	 * \param[in] prefixe : Prfixe du mot recherch
+	 * \param[in] mot : Mot recherch
+	 */
+	int DictionnaireFige::_comparer(uint32_t indice, uint64_t prefixe, std::string_view mot) const
+	{
+		uint64_t p = prefixes[indice];
+		if (p != prefixe)
+			return (p > prefixe) - (p < prefixe);
+
+		//Mme prfixe: il faut comparer les mots au complet
+		size_t longueur = debutMots[indice + 1] - debutMots[indice];
+		size_t commun = longueur < mot.size() ? longueur : mot.size();
+		int resultat = memcmp(reserveMots + debutMots[indice], mot.data(), commun);
+		if (resultat != 0)
+			return resultat;
+		return (longueur > mot.size()) - (longueur < mot.size());
+	}
+
+	/**
+	 * \fn uint32_t DictionnaireFige::_chercher(std::string_view mot) const
+	 * \param[in] mot : Mot recherch
+	 *
+	 * On cherche le dernier mot infrieur ou gal au mot recherch. La boucle fait toujours le
+	 * mme nombre de tours et le choix de la moiti se fait par affectation conditionnelle,
+	 * sans saut imprvisible.
+	 */
+	uint32_t DictionnaireFige::_chercher(std::string_view mot) const
+	{
+		if (nbMots == 0)
+			return nbMots;
+
+		uint64_t prefixe = _prefixe(mot.data(), mot.size());
+		uint32_t base = 0, n = nbMots;
+		while (n > 1)
+		{
+			uint32_t moitie = n / 2;
+			base = (_comparer(base + moitie, prefixe, mot) <= 0) ? base + moitie : base;
+			n -= moitie;
+		}
+
+		return _comparer(base, prefixe, mot) == 0 ? base : nbMots;
+	}
+
+	/**
+	 * \fn uint32_t DictionnaireFige::_borneInferieure(std::string_view mot) const
+	 * \param[in] mot : Mot recherch
+	 */
+	uint32_t DictionnaireFige::_borneInferieure(std::string_view mot) const
+	{
+		uint64_t prefixe = _prefixe(mot.data(), mot.size());
+		uint32_t base = 0, n = nbMots;
+		while (n > 0)
+		{
+			uint32_t moitie = n / 2;
+			if (_comparer(base + moitie, prefixe, mot) < 0)
+			{
+				base += moitie + 1;
+				n -= moitie + 1;
+			}
+			else
+				n = moitie;
+		}
+		return base;
+	}
+
+}//Fin du namespace
@@ -0,0 +1,321 @@
+/**
+ * \file DictionnaireFige.h
+ * \brief Ce fichier contient l'interface d'un dictionnaire fig (lecture seulement).
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+
+
+#ifndef DICO_FIGE_H_
+#define DICO_FIGE_H_
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+#include "Dictionnaire.h"
+#include "FichierMappe.h"
+#include "BorneParcours.h"
+
+namespace TP2P1
+{
+/**
+* \class DictionnaireFige
+*
+* \brief Copie compacte et en lecture seule d'un Dictionnaire
+*
+*  Les mots sont rangs en ordre dans un tableau contigu. Les mots et les traductions sont
+*  mis bout  bout dans deux rserves de caractres, repres par des tableaux de positions.
+*  Un tableau parallle garde les 8 premiers octets de chaque mot sous forme d'entier: la
+*  recherche dichotomique compare d'abord ces entiers et ne lit le mot complet qu'en cas
+*  d'galit.
+*
+*  Tout est allou dans un seul tampon, une fois pour toutes  la construction. Ce tampon peut
+*  tre enregistr tel quel dans un fichier (image binaire), prcd d'un en-tte avec un numro
+*  de version et une somme de contrle. Une image projete en mmoire sert ensuite directement
+*  aux recherches, sans rien reconstruire: le dmarrage ne dpend pas de la taille du dictionnaire.
+*/
+class DictionnaireFige
+{
+public:
+
+	/*
+	*\brief		Constructeur  partir d'un dictionnaire
+	*
+	*\post		L'instance contient tous les mots et toutes les traductions du dictionnaire donn
+	*
+	*\exception	bad_alloc s'il n'y a pas assez de mmoire
+	*
+	*/
+	explicit DictionnaireFige(const Dictionnaire &dico);
+
+	/*
+	*\brief		Constructeur  partir d'une image binaire projete en mmoire
+	*			Seul l'en-tte est vrifi (en temps constant); les tables sont lues directement dans la projection
+	*
+	*\pre		Le fichier reste ouvert tant que l'instance est utilise
+	*
+	*\post		L'instance contient le dictionnaire enregistr par sauvegarder()
+	*
+	*\exception	runtime_error si le fichier n'est pas une image valide de cette version
+	*
+	*/
+	explicit DictionnaireFige(const FichierMappe &fichier);
+
+	/*
+	*\brief		Enregistrer l'image binaire du dictionnaire dans un fichier
+	*
+	*\post		Le fichier contient l'en-tte suivi du tampon, et peut tre relu par le constructeur
+	*
+	*\exception	runtime_error si le fichier ne peut pas tre crit
+	*
+	*/
+	void sauvegarder(const std::string &nomFichier) const;
+
+	/*
+	*\brief		Vrifier la somme de contrle de tout le tampon (en temps linaire)
+	*
+	*\post		On retourne true si le tampon est intact
+	*
+	*/
+	bool verifierSomme() const;
+
+	/*
+	*\brief		Vrifier si un contenu commence par l'en-tte d'une image binaire
+	*
+	*/
+	static bool estImage(std::string_view contenu);
+
+	/*
+	*\brief		Trouver les traductions possibles d'un mot
+	*
+	*\post		Si le mot appartient au dictionnaire, on retoune la liste des traductions du mot donn.
+	*\post		Sinon, on retourne un vecteur vide
+	*
+	*/
+	std::vector<std::string> traduit(const std::string& mot) const;
+
+	/*
+	*\brief		Trouver les traductions possibles d'un mot, sans les copier
+	*
+	*\post		Si le mot appartient au dictionnaire, la vue pointe dans la rserve et trouve() est vrai.
+	*\post		Sinon, la vue est vide et trouve() est faux
+	*
+	*/
+	VueTraductions vueTraductions(std::string_view mot) const;
+
+	/*
+	*\brief		Traduire une phrase mot  mot, sans interaction
+	*			Chaque mot est remplac par sa premire traduction, ou gard tel quel s'il est introuvable
+	*
+	*\post		On retourne la phrase traduite; chaque mot diffrent n'est cherch qu'une fois
+	*
+	*/
+	std::string traduirePhrase(std::string_view phrase) const;
+
+	/*
+	*\brief		Traduire un texte entier mot  mot et l'crire au fur et  mesure dans sortie
+	*
+	*\post		sortie contient le texte traduit
+	*
+	*/
+	void traduireTexte(std::string_view texte, std::ostream &sortie) const;
+
+	/*
+	*\brief		Vrifier si le mot donn appartient au dictionnaire
+	*
+	*\post		On retourne true si le mot est dans le dictionnaire. Sinon, on retourne false.
+	*
+	*/
+	bool appartient(const std::string &mot) const;
+
+	/*
+	*\brief		Suggre des corrections pour le mot motMalEcrit, comme Dictionnaire::suggereCorrections()
+	*			Sans index, une seule passe sur les mots contigus trouve ceux  distance d'dition
+	*			d'au plus Dictionnaire::DISTANCE_MAX; le mme largissement et le mme classement
+	*			donnent les mmes corrections que le Dictionnaire d'origine. S'il n'y en a aucun,
+	*			tous les mots sont nots par lots avec LotSimilitude
+	*
+	*\post		On redonne au plus nbCorrections mots, les plus proches d'abord; sinon ceux dont la similitude dpasse le seuil
+	*
+	*/
+	std::vector<std::string> suggereCorrections(const std::string& motMalEcrit, unsigned int nbCorrections = 10,
+	                                            double seuil = .4) const;
+
+	/*
+	*\brief		Donne le nombre de mots du dictionnaire
+	*
+	*/
+	uint32_t taille() const;
+
+	class Parcours;	// Un parcours en ordre d'une partie des mots
+
+	/*
+	*\brief		Parcourir en ordre les mots qui commencent par un prfixe (compltion)
+	*			Le premier mot est trouv par dichotomie, les suivants sont contigus: O(log n + k)
+	*
+	*\post		Le parcours donne au plus limite mots, en ordre alphabtique
+	*
+	*/
+	Parcours motsAvecPrefixe(std::string_view prefixe, size_t limite) const;
+
+	/*
+	*\brief		Parcourir en ordre les mots de l'intervalle [debut, fin)
+	*
+	*\post		Le parcours donne les mots m tels que debut <= m < fin, en ordre alphabtique
+	*
+	*/
+	Parcours plage(std::string_view debut, std::string_view fin) const;
+
+private:
+
+   /*
+	*\brief		L'en-tte d'une image binaire, suivi du tampon
+	*/
+   struct EnteteImage
+   {
+	   char magie[8];				// "TP2DICO" et un zro
+	   uint32_t version;			// VERSION_IMAGE
+	   uint32_t ordreOctets;		// ORDRE_OCTETS, tel qu'crit par la machine qui a fait l'image
+	   uint32_t nbMots;
+	   uint32_t nbTraductions;
+	   uint32_t tailleMots;			// Le nombre de caractres de la rserve des mots
+	   uint32_t tailleTraductions;	// Le nombre de caractres de la rserve des traductions
+	   uint64_t tailleTampon;		// Le nombre d'entiers de 64 bits du tampon
+	   uint64_t somme;				// La somme de contrle du tampon
+   };
+
+   static const uint32_t VERSION_IMAGE = 1;	//  changer ds que la disposition du tampon change
+
+   static const uint32_t ORDRE_OCTETS = 0x01020304;	// Relu autrement sur une machine d'un autre boutisme
+
+   static const size_t TAILLE_LOT = 256;	// Le nombre de mots nots ensemble par suggereCorrections()
+
+   std::vector<uint64_t> image;	// Le tampon, s'il a t construit en mmoire (vide pour une image projete)
+
+   const uint64_t * tampon;		// Le tampon utilis: image, ou la projection du fichier
+
+   size_t tailleTampon;			// Le nombre d'entiers de 64 bits du tampon
+
+   uint32_t nbMots;				// Le nombre de mots
+
+   uint32_t nbTraductions;		// Le nombre de traductions
+
+   uint32_t tailleMots;			// Le nombre de caractres de reserveMots
+
+   uint32_t tailleTraductions;	// Le nombre de caractres de reserveTraductions
+
+   const uint64_t * prefixes;		// [nbMots] Les 8 premiers octets de chaque mot, gros-boutiste
+   const uint32_t * debutMots;		// [nbMots+1] La position de chaque mot dans reserveMots
+   const uint32_t * debutListes;	// [nbMots+1] L'indice de la premire traduction de chaque mot
+   const uint32_t * debutTraductions;	// [nbTraductions+1] La position de chaque traduction dans reserveTraductions
+   const char * reserveMots;		// Les mots, bout  bout
+   const char * reserveTraductions;	// Les traductions, bout  bout
+
+   // Les tables pointent dans le tampon: l'instance ne se copie pas
+   DictionnaireFige(const DictionnaireFige &);
+   DictionnaireFige & operator=(const DictionnaireFige &);
+
+   /*
+	*\brief		Donne le nombre d'octets du tampon pour les tailles donnes
+	*/
+   static size_t _octetsTampon(uint32_t nbMots, uint32_t nbTraductions, uint32_t tailleMots, uint32_t tailleTraductions);
+
+   /*
+	*\brief		Faire pointer les tables dans le tampon, d'aprs les tailles dj connues
+	*/
+   void _placerTables();
+
+   /*
+	*\brief		La somme de contrle d'un tampon (FNV-1a sur des entiers de 64 bits)
+	*/
+   static uint64_t _somme(const uint64_t * tampon, size_t taille);
+
+   /*
+	*\brief		Ajouter  la liste les noeuds de l'arbre, en ordre
+	*/
+   static void _auxParcourir(const Dictionnaire &dico, Dictionnaire::elem arbre,
+                             std::vector<const Dictionnaire::NoeudDictionnaire *> &noeuds);
+
+   /*
+	*\brief		Donne les 8 premiers octets d'un mot sous forme d'entier comparable
+	*/
+   static uint64_t _prefixe(const char * mot, size_t longueur);
+
+   /*
+	*\brief		Comparer le mot  l'indice donn avec un mot recherch
+	*
+	*\post		On retourne un nombre ngatif, nul ou positif comme std::string::compare
+	*/
+   int _comparer(uint32_t indice, uint64_t prefixe, std::string_view mot) const;
+
+   /*
+	*\brief		Recherche dichotomique sans branchement
+	*
+	*\post		On retourne l'indice du mot, ou nbMots s'il n'y est pas
+	*/
+   uint32_t _chercher(std::string_view mot) const;
+
+   /*
+	*\brief		Donne l'indice du premier mot au moins gal au mot donn, ou nbMots s'il n'y en a pas
+	*/
+   uint32_t _borneInferieure(std::string_view mot) const;
+
+   /*
+	*\brief		Noter tous les mots par similitude et garder les nbCorrections meilleurs au-dessus du seuil
+	*/
+   std::vector<std::string> _parcoursSimilitude(const std::string& motMalEcrit, unsigned int nbCorrections, double seuil) const;
+
+   /*
+	*\brief		Distance d'dition (Levenshtein) entre deux mots, ou borne + 1 ds qu'elle dpasse la borne
+	*/
+   static unsigned int _distanceBornee(std::string_view mot1, std::string_view mot2, unsigned int borne,
+                                       std::vector<unsigned int> &ligne);
+};
+
+/**
+* \class DictionnaireFige::Parcours
+*
+* \brief Donne un  un, en ordre, les mots d'une partie du dictionnaire fig
+*
+*  Les mots sont contigus: le parcours n'est qu'un indice qui avance. Les mots sont donns sans copie.
+*/
+class DictionnaireFige::Parcours
+{
+public:
+
+	/*
+	*\brief		Passer au mot suivant
+	*
+	*\post		On retourne false si le parcours est termin. Sinon, mot est le mot suivant
+	*
+	*/
+	bool suivant(std::string_view &mot);
+
+	/*
+	*\brief		Donne les traductions du dernier mot donn par suivant()
+	*
+	*/
+	VueTraductions traductions() const;
+
+private:
+
+   friend class DictionnaireFige;
+
+   Parcours(const DictionnaireFige &dico, uint32_t debut, const BorneParcours &borne);
+
+   const DictionnaireFige * dico;	// Le dictionnaire parcouru
+
+   uint32_t indice;			// L'indice du prochain mot
+
+   uint32_t courant;			// L'indice du dernier mot donn, ou nbMots
+
+   BorneParcours borne;		// L'arrt du parcours
+};
+
+}
+
+#endif /* DICO_FIGE_H_ */
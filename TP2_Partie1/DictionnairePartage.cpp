@@ -0,0 +1,215 @@
+/**
+ * \file DictionnairePartage.cpp
+ * \brief Ce fichier contient une implantation des mthodes de la classe DictionnairePartage
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+#include "DictionnairePartage.h"
+#include "LotDictionnaire.h"
+#include <functional>
+#include <memory>
+#include <thread>
+namespace TP2P1
+{
+
+	/**
+	 * \fn DictionnairePartage::Lecture::Lecture(const DictionnairePartage &partage)
+	 * \param[in] partage : Le dictionnaire  lire
+	 *
+	 * L'poque est inscrite dans la place avant de lire la version courante (ordre squentiel):
+	 * un crivain qui retire cette version aprs coup voit donc la place occupe par une poque
+	 * qui n'est pas plus rcente que le retrait.
+	 */
+	DictionnairePartage::Lecture::Lecture(const DictionnairePartage &partage) : partage(partage)
+	{
+		//Chaque thread commence ailleurs dans le tableau, pour viter de se disputer les mmes places
+		place = std::hash<std::thread::id>()(std::this_thread::get_id()) % NB_PLACES;
+		for (;;)
+		{
+			uint64_t libre = LIBRE;
+			if (partage.places[place].epoque.compare_exchange_strong(libre, partage.epoque.load()))
+				break;
+			place = (place + 1) % NB_PLACES;
+			if (place == 0)
+				std::this_thread::yield();	// Toutes les places sont prises: on laisse finir une lecture
+		}
+		version = partage.courante.load();
+	}
+
+	/**
+	 * \fn DictionnairePartage::Lecture::~Lecture()
+	 */
+	DictionnairePartage::Lecture::~Lecture()
+	{
+		partage.places[place].epoque.store(LIBRE, std::memory_order_release);
+	}
+
+	/**
+	 * \fn const DictionnaireFige & DictionnairePartage::Lecture::operator*() const
+	 */
+	const DictionnaireFige & DictionnairePartage::Lecture::operator*() const
+	{
+		return *version;
+	}
+
+	/**
+	 * \fn const DictionnaireFige * DictionnairePartage::Lecture::operator->() const
+	 */
+	const DictionnaireFige * DictionnairePartage::Lecture::operator->() const
+	{
+		return version;
+	}
+
+	/**
+	 * \fn DictionnairePartage::DictionnairePartage()
+	 */
+	DictionnairePartage::DictionnairePartage() : epoque(1), courante(0)
+	{
+		for (size_t i = 0; i < NB_PLACES; i++)
+			places[i].epoque.store(LIBRE);
+		courante.store(new DictionnaireFige(dico));
+	}
+
+	/**
+	 * \fn DictionnairePartage::DictionnairePartage(const FichierMappe &fichier)
+	 * \param[in] fichier : Fichier de dictionnaire projet en mmoire
+	 */
+	DictionnairePartage::DictionnairePartage(const FichierMappe &fichier) : epoque(1), courante(0), dico(fichier)
+	{
+		for (size_t i = 0; i < NB_PLACES; i++)
+			places[i].epoque.store(LIBRE);
+		courante.store(new DictionnaireFige(dico));
+	}
+
+	/**
+	 * \fn DictionnairePartage::~DictionnairePartage()
+	 */
+	DictionnairePartage::~DictionnairePartage()
+	{
+		delete courante.load();
+		for (size_t i = 0; i < retirees.size(); i++)
+			delete retirees[i].second;
+	}
+
+	/**
+	 * \fn bool DictionnairePartage::appartient(const std::string &mot) const
+	 * \param[in] mot : Mot  vrifier
+	 */
+	bool DictionnairePartage::appartient(const std::string &mot) const
+	{
+		Lecture lecture(*this);
+		return lecture->appartient(mot);
+	}
+
+	/**
+	 * \fn std::vector<std::string> DictionnairePartage::traduit(const std::string &mot) const
+	 * \param[in] mot : Mot  traduire
+	 */
+	std::vector<std::string> DictionnairePartage::traduit(const std::string &mot) const
+	{
+		Lecture lecture(*this);
+		return lecture->traduit(mot);
+	}
+
+	/**
+	 * \fn std::string DictionnairePartage::traduirePhrase(std::string_view phrase) const
+	 * \param[in] phrase : La phrase  traduire
+	 */
+	std::string DictionnairePartage::traduirePhrase(std::string_view phrase) const
+	{
+		Lecture lecture(*this);
+		return lecture->traduirePhrase(phrase);
+	}
+
+	/**
+	 * \fn void DictionnairePartage::ajouteMot(const std::string &motOriginal, const std::string &motTraduit)
+	 * \param[in] motOriginal : Mot  ajouter
+	 * \param[in] motTraduit : Une traduction possible
+	 */
+	void DictionnairePartage::ajouteMot(const std::string &motOriginal, const std::string &motTraduit)
+	{
+		std::lock_guard<std::mutex> verrou(ecriture);
+		dico.ajouteMot(motOriginal, motTraduit);
+		_publier();
+	}
+
+	/**
+	 * \fn void DictionnairePartage::ajouteMots(const std::vector<std::pair<std::string, std::string> > &paires)
+	 * \param[in] paires : Les mots  ajouter, chacun avec une traduction
+	 *
+	 * Le lot est tri hors du verrou, puis fusionn: fusionner() le vrifie en entier avant de
+	 * toucher  dico, qui ne garde donc jamais un lot refus  moiti.
+	 */
+	void DictionnairePartage::ajouteMots(const std::vector<std::pair<std::string, std::string> > &paires)
+	{
+		LotDictionnaire lot;
+		lot.ajouterPaires(paires);
+
+		std::lock_guard<std::mutex> verrou(ecriture);
+		dico.fusionner(lot);
+		_publier();
+	}
+
+	/**
+	 * \fn void DictionnairePartage::supprimeMot(const std::string &motOriginal)
+	 * \param[in] motOriginal : Mot  supprimer
+	 */
+	void DictionnairePartage::supprimeMot(const std::string &motOriginal)
+	{
+		std::lock_guard<std::mutex> verrou(ecriture);
+		dico.supprimeMot(motOriginal);
+		_publier();
+	}
+
+	/**
+	 * \fn uint64_t DictionnairePartage::nbVersions() const
+	 */
+	uint64_t DictionnairePartage::nbVersions() const
+	{
+		return epoque.load();
+	}
+
+	/**
+	 * \fn void DictionnairePartage::_publier()
+	 *
+	 * L'change de la version prcde l'avance de l'poque: une lecture qui a pu voir l'ancienne
+	 * version a forcment inscrit une poque infrieure ou gale  celle du retrait.
+	 */
+	void DictionnairePartage::_publier()
+	{
+		std::unique_ptr<const DictionnaireFige> nouvelle(new DictionnaireFige(dico));
+		retirees.reserve(retirees.size() + 1);
+
+		const DictionnaireFige * ancienne = courante.exchange(nouvelle.release());
+		retirees.push_back(std::make_pair(epoque.fetch_add(1), ancienne));
+		_liberer();
+	}
+
+	/**
+	 * \fn void DictionnairePartage::_liberer()
+	 */
+	void DictionnairePartage::_liberer()
+	{
+		//La plus ancienne poque encore lue
+		uint64_t plusAncienne = UINT64_MAX;
+		for (size_t i = 0; i < NB_PLACES; i++)
+		{
+			uint64_t e = places[i].epoque.load();
+			if (e != LIBRE && e < plusAncienne)
+				plusAncienne = e;
+		}
+
+		size_t gardees = 0;
+		for (size_t i = 0; i < retirees.size(); i++)
+		{
+			if (retirees[i].first < plusAncienne)
+				delete retirees[i].second;
+			else
+				retirees[gardees++] = retirees[i];
+		}
+		retirees.resize(gardees);
+	}
+
+}
@@ -0,0 +1,220 @@
+/**
+ * \file DictionnairePartage.h
+ * \brief Ce fichier contient l'interface d'un dictionnaire partag entre plusieurs threads.
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+
+
+#ifndef DICO_PARTAGE_H_
+#define DICO_PARTAGE_H_
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <cstdint>
+
+#include "Dictionnaire.h"
+#include "DictionnaireFige.h"
+#include "FichierMappe.h"
+
+namespace TP2P1
+{
+/**
+* \class DictionnairePartage
+*
+* \brief Dictionnaire lu par plusieurs threads sans verrou, et modifi par publication de versions
+*
+*  Les lecteurs consultent la version courante, un DictionnaireFige qui ne change jamais. Un
+*  crivain modifie sous verrou un Dictionnaire priv, en tire une nouvelle version et la publie
+*  d'un seul change atomique: les lecteurs en cours gardent l'ancienne, les suivants voient la
+*  nouvelle. Ni les lecteurs ni l'crivain ne s'attendent.
+*
+*  Une ancienne version est libre par poques: chaque lecture occupe une place o elle inscrit
+*  l'poque  laquelle elle a commenc, et une version retire n'est dtruite que lorsqu'aucune
+*  lecture commence avant son retrait n'est encore active.
+*
+*  Chaque publication reconstruit toute la version, en O(n): ajouteMot() et supprimeMot() cotent
+*  donc chacun une copie complte du dictionnaire. Les critures doivent passer par ajouteMots(),
+*  qui regroupe un lot d'ajouts en une seule publication; les deux autres ne conviennent qu' une
+*  modification isole et rare.
+*/
+class DictionnairePartage
+{
+public:
+
+	/**
+	* \class Lecture
+	*
+	* \brief Accs  la version courante, valide tant que l'objet existe
+	*
+	*  Une Lecture ne prend aucun verrou. Elle est faite pour tre courte: tant qu'elle existe,
+	*  les versions retires depuis son dbut ne peuvent pas tre libres.
+	*/
+	class Lecture
+	{
+	public:
+
+		/*
+		*\brief		Commencer une lecture
+		*
+		*\post		La lecture occupe une place et donne la version courante
+		*
+		*/
+		explicit Lecture(const DictionnairePartage &partage);
+
+		/*
+		*\brief		Terminer la lecture
+		*
+		*\post		La place est libre
+		*
+		*/
+		~Lecture();
+
+		const DictionnaireFige & operator*() const;
+		const DictionnaireFige * operator->() const;
+
+	private:
+
+		Lecture(const Lecture &);
+		Lecture & operator=(const Lecture &);
+
+		const DictionnairePartage &partage;	// Le dictionnaire lu
+
+		size_t place;		// La place occupe par la lecture
+
+		const DictionnaireFige * version;	// La version lue
+	};
+
+	/*
+	*\brief		Constructeur d'un dictionnaire vide
+	*
+	*/
+	DictionnairePartage();
+
+	/*
+	*\brief		Constructeur  partir d'un fichier projet en mmoire
+	*
+	*\post		La premire version contient les mots du fichier
+	*
+	*/
+	explicit DictionnairePartage(const FichierMappe &fichier);
+
+	/*
+	*\brief		Destructeur
+	*
+	*\pre		Aucune lecture n'est en cours
+	*
+	*/
+	~DictionnairePartage();
+
+	/*
+	*\brief		Vrifier si le mot appartient  la version courante
+	*
+	*/
+	bool appartient(const std::string &mot) const;
+
+	/*
+	*\brief		Trouver les traductions d'un mot dans la version courante
+	*
+	*\post		On retourne une copie des traductions, ou un vecteur vide
+	*
+	*/
+	std::vector<std::string> traduit(const std::string &mot) const;
+
+	/*
+	*\brief		Traduire une phrase mot  mot avec la version courante
+	*
+	*/
+	std::string traduirePhrase(std::string_view phrase) const;
+
+	/*
+	*\brief		Ajouter un mot et publier la nouvelle version
+	*			Reconstruit toute la version (O(n)): pour plusieurs mots, utiliser ajouteMots()
+	*
+	*\post		Les lectures commences aprs l'appel voient le mot
+	*
+	*\exception	bad_alloc s'il n'y a pas assez de mmoire; la version courante reste alors publie
+	*
+	*/
+	void ajouteMot(const std::string &motOriginal, const std::string &motTraduit);
+
+	/*
+	*\brief		Ajouter plusieurs mots et publier une seule nouvelle version
+	*			Les traductions d'un mot s'ajoutent dans l'ordre des paires, comme avec ajouteMot()
+	*
+	*\post		Les lectures commences aprs l'appel voient tous les mots
+	*
+	*\exception	length_error si un mot aurait plus de MAX_TRADUCTIONS traductions: aucune paire n'est
+	*			ajoute, rien n'est publi et les lecteurs gardent la version courante
+	*\exception	bad_alloc s'il n'y a pas assez de mmoire; la version courante reste alors publie,
+	*			mais une partie du lot peut tre garde et paratre  la publication suivante
+	*
+	*/
+	void ajouteMots(const std::vector<std::pair<std::string, std::string> > &paires);
+
+	/*
+	*\brief		Supprimer un mot et publier la nouvelle version
+	*			Reconstruit toute la version (O(n)), comme ajouteMot()
+	*
+	*\post		Les lectures commences aprs l'appel ne voient plus le mot
+	*
+	*\exception	logic_error si le mot n'appartient pas au dictionnaire
+	*
+	*/
+	void supprimeMot(const std::string &motOriginal);
+
+	/*
+	*\brief		Donne le nombre de versions publies, la premire comprise
+	*
+	*/
+	uint64_t nbVersions() const;
+
+private:
+
+   DictionnairePartage(const DictionnairePartage &);
+   DictionnairePartage & operator=(const DictionnairePartage &);
+
+   static const size_t NB_PLACES = 128;	// Le nombre de lectures simultanes possibles
+
+   static const uint64_t LIBRE = 0;		// La valeur d'une place sans lecture
+
+   // Une place par ligne de cache, pour que les lecteurs ne se gnent pas
+   struct alignas(64) Place
+   {
+	   std::atomic<uint64_t> epoque;	// L'poque du dbut de la lecture, ou LIBRE
+   };
+
+   mutable Place places[NB_PLACES];		// Les places des lectures en cours
+
+   std::atomic<uint64_t> epoque;		// L'poque courante; avance  chaque publication
+
+   std::atomic<const DictionnaireFige *> courante;	// La version lue par les nouvelles lectures
+
+   std::mutex ecriture;		// Srialise les crivains; les lecteurs ne le prennent jamais
+
+   Dictionnaire dico;		// L'tat modifiable, d'o sont tires les versions
+
+   std::vector<std::pair<uint64_t, const DictionnaireFige *> > retirees;	// Les versions remplaces et l'poque de leur retrait
+
+   /*
+	*\brief		Publier une version tire de dico, puis librer les versions retires qui ne sont plus lues
+	*			L'appelant tient le verrou ecriture
+	*/
+   void _publier();
+
+   /*
+	*\brief		Librer les versions retires qu'aucune lecture active ne peut encore voir
+	*			L'appelant tient le verrou ecriture
+	*/
+   void _liberer();
+};
+
+}
+
+#endif /* DICO_PARTAGE_H_ */
@@ -0,0 +1,133 @@
+/**
+ * \file FichierMappe.cpp
+ * \brief Ce fichier contient une implantation des mthodes de la classe FichierMappe
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+#include "FichierMappe.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace TP2P1
+{
+
+	/**
+	 * \fn FichierMappe::FichierMappe(const std::string &nomFichier, Acces acces)
+	 * \param[in] nomFichier : Le nom du fichier  projeter
+	 * \param[in] acces : La faon dont le contenu sera lu
+	 */
+	FichierMappe::FichierMappe(const std::string &nomFichier, Acces acces) : debut(0), taille(0), ouvert(false)
+	{
+#ifdef _WIN32
+		DWORD conseil = 0;
+		if (acces == ACCES_SEQUENTIEL)
+			conseil = FILE_FLAG_SEQUENTIAL_SCAN;
+		else if (acces == ACCES_ALEATOIRE)
+			conseil = FILE_FLAG_RANDOM_ACCESS;
+		HANDLE fichier = CreateFileA(nomFichier.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+		                             OPEN_EXISTING, conseil, NULL);
+		if (fichier == INVALID_HANDLE_VALUE)
+			return;
+
+		LARGE_INTEGER octets;
+		if (!GetFileSizeEx(fichier, &octets))
+		{
+			CloseHandle(fichier);
+			return;
+		}
+		ouvert = true;
+		taille = static_cast<size_t>(octets.QuadPart);
+
+		//Un fichier vide ne peut pas tre projet
+		if (taille != 0)
+		{
+			HANDLE projection = CreateFileMappingA(fichier, NULL, PAGE_READONLY, 0, 0, NULL);
+			if (projection != NULL)
+			{
+				debut = static_cast<const char *>(MapViewOfFile(projection, FILE_MAP_READ, 0, 0, 0));
+				CloseHandle(projection); //La vue garde la projection ouverte
+			}
+			if (debut == 0)
+			{
+				ouvert = false;
+				taille = 0;
+			}
+		}
+		CloseHandle(fichier);
+#else
+		int fichier = open(nomFichier.c_str(), O_RDONLY);
+		if (fichier < 0)
+			return;
+
+		struct stat infos;
+		if (fstat(fichier, &infos) != 0)
+		{
+			close(fichier);
+			return;
+		}
+		ouvert = true;
+		taille = static_cast<size_t>(infos.st_size);
+
+		//Un fichier vide ne peut pas tre projet
+		if (taille != 0)
+		{
+			void *projection = mmap(0, taille, PROT_READ, MAP_PRIVATE, fichier, 0);
+			if (projection == MAP_FAILED)
+			{
+				ouvert = false;
+				taille = 0;
+			}
+			else
+			{
+				debut = static_cast<const char *>(projection);
+				if (acces == ACCES_SEQUENTIEL)
+					madvise(projection, taille, MADV_SEQUENTIAL);
+				else if (acces == ACCES_ALEATOIRE)
+					madvise(projection, taille, MADV_RANDOM);
+			}
+		}
+		close(fichier); //La projection reste valide aprs la fermeture
+#endif
+	}
+
+	/**
+	 * \fn FichierMappe::~FichierMappe()
+	 */
+	FichierMappe::~FichierMappe()
+	{
+		if (debut == 0)
+			return;
+#ifdef _WIN32
+		UnmapViewOfFile(debut);
+#else
+		munmap(const_cast<char *>(debut), taille);
+#endif
+	}
+
+	/**
+	 * \fn bool FichierMappe::estOuvert() const
+	 */
+	bool FichierMappe::estOuvert() const
+	{
+		return ouvert;
+	}
+
+	/**
+	 * \fn std::string_view FichierMappe::contenu() const
+	 */
+	std::string_view FichierMappe::contenu() const
+	{
+		return std::string_view(debut, taille);
+	}
+
+}//Fin du namespace
@@ -0,0 +1,85 @@
+/**
+ * \file FichierMappe.h
+ * \brief Ce fichier contient l'interface d'un fichier projet en mmoire, en lecture seulement.
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+
+
+#ifndef FICHIER_MAPPE_H_
+#define FICHIER_MAPPE_H_
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+namespace TP2P1
+{
+/**
+* \class FichierMappe
+*
+* \brief Le contenu d'un fichier, projet en mmoire par le systme (mmap ou CreateFileMapping)
+*
+*  Le fichier n'est pas copi: les pages sont lues par le systme au fur et  mesure
+*  qu'on les touche. Le contenu reste valide tant que l'instance existe. L'accs annonc  la
+*  construction rgle la lecture anticipe du systme: un texte se lit du dbut  la fin, une
+*  image de DictionnaireFige par recherche binaire.
+*/
+class FichierMappe
+{
+public:
+
+	enum Acces
+	{
+		ACCES_SEQUENTIEL,	// Lu du dbut  la fin (MADV_SEQUENTIAL): grande lecture anticipe, pages libres derrire
+		ACCES_NORMAL,		// Sans conseil (MADV_NORMAL): lecture anticipe modre
+		ACCES_ALEATOIRE		// Lu en dsordre (MADV_RANDOM): seules les pages touches sont lues
+	};
+
+	/*
+	*\brief		Projeter un fichier en mmoire
+	*
+	*\post		Si le fichier a pu tre ouvert, contenu() donne tout le fichier. Sinon, estOuvert() est faux
+	*\post		Le systme est prvenu de l'accs annonc
+	*
+	*/
+	explicit FichierMappe(const std::string &nomFichier, Acces acces = ACCES_SEQUENTIEL);
+
+	/*
+	*\brief		Destructeur
+	*
+	*\post		La projection et le fichier sont ferms
+	*
+	*/
+	~FichierMappe();
+
+	/*
+	*\brief		Vrai si le fichier a pu tre ouvert et projet
+	*
+	*/
+	bool estOuvert() const;
+
+	/*
+	*\brief		Le contenu du fichier (vide si le fichier est vide ou n'a pas pu tre ouvert)
+	*
+	*/
+	std::string_view contenu() const;
+
+private:
+
+   const char *debut;	// Le dbut de la projection (0 si le fichier est vide)
+
+   size_t taille;		// La taille du fichier, en octets
+
+   bool ouvert;			// Le fichier a pu tre ouvert
+
+   // La projection appartient  l'instance: elle ne se copie pas
+   FichierMappe(const FichierMappe &);
+   FichierMappe & operator=(const FichierMappe &);
+};
+
+}
+
+#endif /* FICHIER_MAPPE_H_ */
@@ -0,0 +1,148 @@
+/**
+ * \file LotDictionnaire.cpp
+ * \brief Ce fichier contient une implantation des mthodes de la classe LotDictionnaire
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+#include "LotDictionnaire.h"
+#include <algorithm>
+#include <stdexcept>
+namespace TP2P1
+{
+
+	/**
+	 * \fn bool _motPlusPetit(const Dictionnaire::Paire &a, const Dictionnaire::Paire &b)
+	 *
+	 * \param[in] a : Premire paire
+	 * \param[in] b : Deuxime paire
+	 *
+	 * Compare seulement les mots: un tri stable garde les traductions d'un mot dans l'ordre des sources.
+	 */
+	static bool _motPlusPetit(const Dictionnaire::Paire &a, const Dictionnaire::Paire &b)
+	{
+		return a.first < b.first;
+	}
+
+	/**
+	 * \fn LotDictionnaire::LotDictionnaire()
+	 */
+	LotDictionnaire::LotDictionnaire()
+	{
+	}
+
+	/**
+	 * \fn void LotDictionnaire::ajouterFichier(const std::string &nomFichier)
+	 * \param[in] nomFichier : Le fichier de dictionnaire
+	 */
+	void LotDictionnaire::ajouterFichier(const std::string &nomFichier)
+	{
+		std::unique_ptr<FichierMappe> fichier(new FichierMappe(nomFichier));
+		if (!fichier->estOuvert())
+			throw std::runtime_error("ajouterFichier: impossible d'ouvrir le fichier " + nomFichier + "\n");
+
+		std::string_view contenu = fichier->contenu();
+		fichiers.push_back(std::move(fichier));
+		_ajouter(contenu);
+	}
+
+	/**
+	 * \fn void LotDictionnaire::ajouterTexte(std::string texte)
+	 * \param[in] texte : Le texte, au format d'un fichier de dictionnaire
+	 */
+	void LotDictionnaire::ajouterTexte(std::string texte)
+	{
+		textes.push_back(std::unique_ptr<std::string>(new std::string(std::move(texte))));
+		_ajouter(*textes.back());
+	}
+
+	/**
+	 * \fn void LotDictionnaire::ajouterPaires(const std::vector<std::pair<std::string, std::string> > &paires)
+	 * \param[in] paires : Les mots, chacun avec une traduction, dans l'ordre o les ajouter
+	 *
+	 * Les chanes sont recopies bout  bout dans un seul texte, dans lequel pointent les paires.
+	 */
+	void LotDictionnaire::ajouterPaires(const std::vector<std::pair<std::string, std::string> > &paires)
+	{
+		size_t longueur = 0;
+		for (size_t i = 0; i < paires.size(); i++)
+			longueur += paires[i].first.size() + paires[i].second.size();
+		std::unique_ptr<std::string> texte(new std::string());
+		texte->reserve(longueur);
+		for (size_t i = 0; i < paires.size(); i++)
+			texte->append(paires[i].first).append(paires[i].second);
+		lot.reserve(lot.size() + paires.size());
+		textes.push_back(std::move(texte));
+
+		size_t debut = lot.size();
+		std::string_view reste = *textes.back();
+		for (size_t i = 0; i < paires.size(); i++)
+		{
+			std::string_view mot = reste.substr(0, paires[i].first.size());
+			reste.remove_prefix(mot.size());
+			std::string_view traduction = reste.substr(0, paires[i].second.size());
+			reste.remove_prefix(traduction.size());
+			lot.push_back(Dictionnaire::Paire(mot, traduction));
+		}
+		_ranger(debut);
+	}
+
+	/**
+	 * \fn std::future<LotDictionnaire> LotDictionnaire::analyserEnArrierePlan(std::vector<std::string> nomsFichiers)
+	 * \param[in] nomsFichiers : Les fichiers de dictionnaire, dans l'ordre o leurs traductions s'ajoutent
+	 */
+	std::future<LotDictionnaire> LotDictionnaire::analyserEnArrierePlan(std::vector<std::string> nomsFichiers)
+	{
+		return std::async(std::launch::async, [nomsFichiers]()
+		{
+			LotDictionnaire lot;
+			for (size_t i = 0; i < nomsFichiers.size(); i++)
+				lot.ajouterFichier(nomsFichiers[i]);
+			return lot;
+		});
+	}
+
+	/**
+	 * \fn const std::vector<Dictionnaire::Paire> & LotDictionnaire::paires() const
+	 */
+	const std::vector<Dictionnaire::Paire> & LotDictionnaire::paires() const
+	{
+		return lot;
+	}
+
+	/**
+	 * \fn size_t LotDictionnaire::taille() const
+	 */
+	size_t LotDictionnaire::taille() const
+	{
+		return lot.size();
+	}
+
+	/**
+	 * \fn void LotDictionnaire::_ajouter(std::string_view texte)
+	 * \param[in] texte : Le texte  dcouper; il doit vivre aussi longtemps que le lot
+	 *
+	 */
+	void LotDictionnaire::_ajouter(std::string_view texte)
+	{
+		size_t debut = lot.size();
+		Dictionnaire::analyserTexte(texte, lot);
+		_ranger(debut);
+	}
+
+	/**
+	 * \fn void LotDictionnaire::_ranger(size_t debut)
+	 * \param[in] debut : La premire des paires ajoutes
+	 *
+	 * Les nouvelles paires sont tries  part, puis fusionnes (de faon stable) avec les
+	 * prcdentes: les traductions des sources dj ajoutes restent les premires.
+	 */
+	void LotDictionnaire::_ranger(size_t debut)
+	{
+		if (!std::is_sorted(lot.begin() + debut, lot.end(), _motPlusPetit))
+			std::stable_sort(lot.begin() + debut, lot.end(), _motPlusPetit);
+		std::inplace_merge(lot.begin(), lot.begin() + debut, lot.end(), _motPlusPetit);
+	}
+
+}
@@ -0,0 +1,114 @@
+/**
+ * \file LotDictionnaire.h
+ * \brief Ce fichier contient l'interface d'un lot de mots  fusionner dans un dictionnaire.
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+
+
+#ifndef LOT_DICO_H_
+#define LOT_DICO_H_
+
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Dictionnaire.h"
+#include "FichierMappe.h"
+
+namespace TP2P1
+{
+/**
+* \class LotDictionnaire
+*
+* \brief Les paires (mot, traduction) d'un ou de plusieurs fichiers, dcoupes et tries, prtes  fusionner
+*
+*  Le lot garde ses sources (fichiers projets en mmoire ou textes) et des paires qui pointent
+*  dedans, sans copie. Les paires sont tries par mot; les traductions d'un mme mot restent dans
+*  l'ordre des sources, puis des lignes. Le dcoupage et le tri ne touchent  aucun dictionnaire:
+*  ils peuvent se faire dans un autre thread, par exemple avec analyserEnArrierePlan(), pendant
+*  que le dictionnaire sert toujours. Seul Dictionnaire::fusionner() modifie l'arbre.
+*/
+class LotDictionnaire
+{
+public:
+
+	/*
+	*\brief		Constructeur d'un lot vide
+	*
+	*/
+	LotDictionnaire();
+
+	/*
+	*\brief		Ajouter au lot les mots d'un fichier de dictionnaire
+	*
+	*\post		Le fichier reste projet tant que le lot existe; ses paires sont fusionnes avec celles du lot
+	*
+	*\exception	runtime_error si le fichier ne peut pas tre ouvert
+	*
+	*/
+	void ajouterFichier(const std::string &nomFichier);
+
+	/*
+	*\brief		Ajouter au lot les mots d'un texte au format d'un fichier de dictionnaire (glossaire, mise  jour)
+	*
+	*\post		Le lot garde le texte; ses paires sont fusionnes avec celles du lot
+	*
+	*/
+	void ajouterTexte(std::string texte);
+
+	/*
+	*\brief		Ajouter au lot des paires (mot, traduction) dj spares, sans dcoupage
+	*
+	*\post		Le lot garde une copie des mots et des traductions; les paires sont fusionnes avec celles du lot
+	*
+	*/
+	void ajouterPaires(const std::vector<std::pair<std::string, std::string> > &paires);
+
+	/*
+	*\brief		Dcouper et trier des fichiers dans un autre thread
+	*
+	*\post		Le futur donne le lot de tous les fichiers, ou relance l'exception de ajouterFichier()
+	*
+	*/
+	static std::future<LotDictionnaire> analyserEnArrierePlan(std::vector<std::string> nomsFichiers);
+
+	/*
+	*\brief		Donne les paires du lot, tries par mot
+	*
+	*/
+	const std::vector<Dictionnaire::Paire> & paires() const;
+
+	/*
+	*\brief		Donne le nombre de paires
+	*
+	*/
+	size_t taille() const;
+
+private:
+
+   std::vector<std::unique_ptr<FichierMappe> > fichiers;	// Les fichiers dans lesquels pointent les paires
+
+   std::vector<std::unique_ptr<std::string> > textes;	// Les textes dans lesquels pointent les paires; ils ne bougent pas si le lot est dplac
+
+   std::vector<Dictionnaire::Paire> lot;	// Les paires, tries par mot
+
+   /*
+	*\brief		Dcouper un texte, trier ses paires et les fusionner avec celles dj dans le lot
+	*/
+   void _ajouter(std::string_view texte);
+
+   /*
+	*\brief		Trier les paires ajoutes  partir de debut et les fusionner avec celles d'avant
+	*/
+   void _ranger(size_t debut);
+};
+
+}
+
+#endif /* LOT_DICO_H_ */
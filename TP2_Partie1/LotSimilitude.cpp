@@ -0,0 +1,340 @@
+/**
+ * \file LotSimilitude.cpp
+ * \brief Ce fichier contient une implantation des mthodes de la classe LotSimilitude
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+#include "LotSimilitude.h"
+#include <string.h>
+#include <atomic>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define LOT_SIMILITUDE_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+//Avec gcc et clang, seules ces fonctions ont le droit d'utiliser SSE2 ou AVX2;
+//le reste du programme reste compil pour n'importe quel processeur.
+#if defined(__GNUC__)
+#define CIBLE_SSE2 __attribute__((target("sse2")))
+#define CIBLE_AVX2 __attribute__((target("avx2")))
+#else
+#define CIBLE_SSE2
+#define CIBLE_AVX2
+#endif
+
+namespace TP2P1
+{
+
+	namespace
+	{
+		/**
+		 * \fn unsigned int _compterBits(uint64_t x)
+		 * \param[in] x : Un masque
+		 *
+		 * \return Le nombre de bits  1
+		 */
+		inline unsigned int _compterBits(uint64_t x)
+		{
+#if defined(__GNUC__)
+			return static_cast<unsigned int>(__builtin_popcountll(x));
+#else
+			x = x - ((x >> 1) & 0x5555555555555555ULL);
+			x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+			x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+			return static_cast<unsigned int>((x * 0x0101010101010101ULL) >> 56);
+#endif
+		}
+
+		/*
+		 * Les fonctions _tour* font un tour de longueur L sur les n premiers masques:
+		 * elles retournent le OU des suites[p] (les sous-mots de longueur L trouvs), puis
+		 * passent  la longueur L+1: suites[p] &= egalites[p + L] >> L.
+		 * egalites doit avoir au moins 4 zros aprs le dernier masque utile.
+		 */
+
+		/**
+		 * \fn uint64_t _tourScalaire(uint64_t *suites, const uint64_t *egalites, size_t n, unsigned int longueur)
+		 * \param[in,out] suites : Les sous-mots de longueur L qui commencent  chaque lettre du plus grand mot
+		 * \param[in] egalites : Les masques d'galit de chaque lettre du plus grand mot
+		 * \param[in] n : Le nombre de lettres o un sous-mot de longueur L peut commencer
+		 * \param[in] longueur : La longueur L
+		 */
+		uint64_t _tourScalaire(uint64_t *suites, const uint64_t *egalites, size_t n, unsigned int longueur)
+		{
+			uint64_t departs = 0;
+			for (size_t p = 0; p < n; p++)
+			{
+				departs |= suites[p];
+				suites[p] &= longueur < 64 ? egalites[p + longueur] >> longueur : 0;
+			}
+			return departs;
+		}
+
+#ifdef LOT_SIMILITUDE_X86
+		/**
+		 * \fn uint64_t _tourSse2(uint64_t *suites, const uint64_t *egalites, size_t n, unsigned int longueur)
+		 *
+		 * Mme travail que _tourScalaire, 2 masques  la fois.
+		 */
+		CIBLE_SSE2 uint64_t _tourSse2(uint64_t *suites, const uint64_t *egalites, size_t n, unsigned int longueur)
+		{
+			const __m128i decalage = _mm_cvtsi32_si128(static_cast<int>(longueur));
+			__m128i departs = _mm_setzero_si128();
+			size_t p = 0;
+			for (; p + 2 <= n; p += 2)
+			{
+				__m128i suite = _mm_loadu_si128(reinterpret_cast<const __m128i *>(suites + p));
+				__m128i suivante = _mm_loadu_si128(reinterpret_cast<const __m128i *>(egalites + p + longueur));
+				departs = _mm_or_si128(departs, suite);
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(suites + p), _mm_and_si128(suite, _mm_srl_epi64(suivante, decalage)));
+			}
+
+			alignas(16) uint64_t moities[2];
+			_mm_store_si128(reinterpret_cast<__m128i *>(moities), departs);
+			return (moities[0] | moities[1]) | _tourScalaire(suites + p, egalites + p, n - p, longueur);
+		}
+
+		/**
+		 * \fn uint64_t _tourAvx2(uint64_t *suites, const uint64_t *egalites, size_t n, unsigned int longueur)
+		 *
+		 * Mme travail que _tourScalaire, 4 masques  la fois.
+		 */
+		CIBLE_AVX2 uint64_t _tourAvx2(uint64_t *suites, const uint64_t *egalites, size_t n, unsigned int longueur)
+		{
+			const __m128i decalage = _mm_cvtsi32_si128(static_cast<int>(longueur));
+			__m256i departs = _mm256_setzero_si256();
+			size_t p = 0;
+			for (; p + 4 <= n; p += 4)
+			{
+				__m256i suite = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(suites + p));
+				__m256i suivante = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(egalites + p + longueur));
+				departs = _mm256_or_si256(departs, suite);
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(suites + p), _mm256_and_si256(suite, _mm256_srl_epi64(suivante, decalage)));
+			}
+
+			alignas(32) uint64_t quarts[4];
+			_mm256_store_si256(reinterpret_cast<__m256i *>(quarts), departs);
+			return (quarts[0] | quarts[1] | quarts[2] | quarts[3]) | _tourScalaire(suites + p, egalites + p, n - p, longueur);
+		}
+#endif
+	}
+
+	/**
+	 * \fn LotSimilitude::LotSimilitude(std::string_view requete)
+	 * \param[in] requete : Le mot compar  tous les candidats
+	 */
+	LotSimilitude::LotSimilitude(std::string_view requete) : requete(requete)
+	{
+		memset(masquesRequete, 0, sizeof(masquesRequete));
+		if (requete.size() <= TAILLE_MAX)
+		{
+			for (size_t j = 0; j < requete.size(); j++)
+				masquesRequete[static_cast<unsigned char>(requete[j])] |= uint64_t(1) << j;
+		}
+	}
+
+	/**
+	 * \fn void LotSimilitude::noter(const std::string_view *candidats, size_t nbCandidats, double *scores) const
+	 * \param[in] candidats : Les mots  comparer  la requte
+	 * \param[in] nbCandidats : Le nombre de candidats
+	 * \param[out] scores : Le score de chaque candidat
+	 */
+	void LotSimilitude::noter(const std::string_view *candidats, size_t nbCandidats, double *scores) const
+	{
+		uint64_t masquesCandidat[256];
+		memset(masquesCandidat, 0, sizeof(masquesCandidat));
+
+		for (size_t i = 0; i < nbCandidats; i++)
+		{
+			if (requete.size() <= TAILLE_MAX && candidats[i].size() <= TAILLE_MAX)
+				scores[i] = _noterCourt(candidats[i], masquesCandidat);
+			else
+				scores[i] = similitude(candidats[i], requete);
+		}
+	}
+
+	/**
+	 * \fn double LotSimilitude::_noterCourt(std::string_view candidat, uint64_t *masquesCandidat) const
+	 * \param[in] candidat : Mot  comparer  la requte
+	 * \param[in,out] masquesCandidat : Table des masques, pour le candidat s'il est le plus petit mot
+	 */
+	double LotSimilitude::_noterCourt(std::string_view candidat, uint64_t *masquesCandidat) const
+	{
+		//Mmes rles que similitude(candidat, requete):  longueur gale, la requte est le plus grand mot
+		const uint64_t *masques;
+		std::string_view bigger, smaller;
+		if (candidat.size() > requete.size())
+		{
+			masques = masquesRequete;
+			bigger = candidat;
+			smaller = requete;
+		}
+		else
+		{
+			for (size_t j = 0; j < candidat.size(); j++)
+				masquesCandidat[static_cast<unsigned char>(candidat[j])] |= uint64_t(1) << j;
+			masques = masquesCandidat;
+			bigger = requete;
+			smaller = candidat;
+		}
+
+		//egalites[p] : les positions du plus petit mot o se trouve la lettre bigger[p]
+		uint64_t egalites[TAILLE_MAX + 4];
+		uint64_t suites[TAILLE_MAX];
+		const size_t b = bigger.size();
+		for (size_t p = 0; p < b; p++)
+			egalites[p] = suites[p] = masques[static_cast<unsigned char>(bigger[p])];
+		for (size_t p = b; p < b + 4; p++)
+			egalites[p] = 0;
+
+		//Le jeu d'instructions est lu une fois par candidat: un autre thread peut le changer
+		JeuInstructions jeu = _jeuCourant().load(std::memory_order_relaxed);
+
+		double similarity = 0.;
+		for (unsigned int longueur = 1; longueur <= smaller.size(); longueur++)
+		{
+			uint64_t departs;
+			size_t n = b - longueur + 1; // Les lettres o un sous-mot de cette longueur peut commencer
+			switch (jeu)
+			{
+#ifdef LOT_SIMILITUDE_X86
+			case AVX2:
+				departs = _tourAvx2(suites, egalites, n, longueur);
+				break;
+			case SSE2:
+				departs = _tourSse2(suites, egalites, n, longueur);
+				break;
+#endif
+			default:
+				departs = _tourScalaire(suites, egalites, n, longueur);
+				break;
+			}
+
+			if (departs == 0) //Aucun sous-mot de cette longueur: aucun plus long non plus
+				break;
+			similarity += _compterBits(departs);
+		}
+
+		if (masques == masquesCandidat)
+		{
+			for (size_t j = 0; j < candidat.size(); j++)
+				masquesCandidat[static_cast<unsigned char>(candidat[j])] = 0;
+		}
+
+		return similarity / (smaller.size() * smaller.size());
+	}
+
+	/**
+	 * \fn double LotSimilitude::similitude(std::string_view mot1, std::string_view mot2)
+	 * \param[in] mot1 : Premier mot
+	 * \param[in] mot2 : Deuxieme mot
+	 *
+	 * Le score compte, pour chaque lettre j du plus petit mot, les sous-mots qui commencent en j
+	 * et qui se trouvent dans le plus grand mot. Si un sous-mot s'y trouve, ses prfixes aussi:
+	 * ce nombre est donc la longueur du plus long prfixe de smaller[j..] prsent dans bigger.
+	 *
+	 * On l'obtient en parcourant chaque diagonale (smaller[j] face  bigger[j + d]) de la fin vers
+	 * le dbut, en comptant les lettres gales conscutives: O(L) comparaisons. Les maximums
+	 * sont gards dans un tableau local de TAILLE_TRANCHE lettres; un mot plus long est trait
+	 * par tranches, sans jamais allouer de mmoire.
+	 */
+	double LotSimilitude::similitude(std::string_view mot1, std::string_view mot2)
+	{
+		double similarity = 0.;
+		std::string_view bigger = mot1.size() > mot2.size() ? mot1 : mot2;
+		std::string_view smaller = mot1.size() > mot2.size() ? mot2 : mot1;
+		const long s = static_cast<long>(smaller.size());
+		const long b = static_cast<long>(bigger.size());
+
+		size_t meilleur[TAILLE_TRANCHE];	// Le plus long prfixe trouv pour chaque lettre de la tranche
+		for (long debut = 0; debut < s; debut += TAILLE_TRANCHE)
+		{
+			long fin = debut + static_cast<long>(TAILLE_TRANCHE) < s ? debut + static_cast<long>(TAILLE_TRANCHE) : s;
+			for (long j = 0; j < fin - debut; j++)
+				meilleur[j] = 0;
+
+			//Pour chaque dcalage d, smaller[j] est compar  bigger[j + d]
+			for (long d = -(fin - 1); d < b; d++)
+			{
+				long jFin = b - d < s ? b - d : s;		// Premier j hors de bigger
+				long jDebut = -d > debut ? -d : debut;	// Premier j de la tranche dans bigger
+				size_t suite = 0;
+				for (long j = jFin - 1; j >= jDebut; j--)
+				{
+					suite = (smaller[j] == bigger[j + d]) ? suite + 1 : 0;
+					if (j < fin && suite > meilleur[j - debut])
+						meilleur[j - debut] = suite;
+				}
+			}
+
+			for (long j = 0; j < fin - debut; j++)
+				similarity += meilleur[j];
+		}
+
+		double score = similarity  / (smaller.size() * smaller.size());
+		return score;
+	}
+
+	/**
+	 * \fn LotSimilitude::JeuInstructions LotSimilitude::jeuInstructions()
+	 */
+	LotSimilitude::JeuInstructions LotSimilitude::jeuInstructions()
+	{
+		return _jeuCourant().load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * \fn void LotSimilitude::choisirJeuInstructions(JeuInstructions jeu)
+	 * \param[in] jeu : Le jeu d'instructions voulu
+	 */
+	void LotSimilitude::choisirJeuInstructions(JeuInstructions jeu)
+	{
+		if (jeu <= _detecter())
+			_jeuCourant().store(jeu, std::memory_order_relaxed);
+	}
+
+	/**
+	 * \fn std::atomic<LotSimilitude::JeuInstructions> & LotSimilitude::_jeuCourant()
+	 *
+	 * La dtection est faite une seule fois, au premier appel, mme si plusieurs threads y arrivent
+	 * ensemble; la valeur est atomique parce que choisirJeuInstructions() peut la changer pendant
+	 * que d'autres threads notent des candidats.
+	 */
+	std::atomic<LotSimilitude::JeuInstructions> & LotSimilitude::_jeuCourant()
+	{
+		static std::atomic<JeuInstructions> jeu(_detecter());
+		return jeu;
+	}
+
+	/**
+	 * \fn LotSimilitude::JeuInstructions LotSimilitude::_detecter()
+	 */
+	LotSimilitude::JeuInstructions LotSimilitude::_detecter()
+	{
+#if defined(LOT_SIMILITUDE_X86) && defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 1);
+		bool sse2 = (info[3] & (1 << 26)) != 0;
+		bool avx = (info[2] & (1 << 28)) != 0 && (info[2] & (1 << 27)) != 0; //AVX et OSXSAVE
+		__cpuidex(info, 7, 0);
+		bool avx2 = avx && (info[1] & (1 << 5)) != 0 && (_xgetbv(0) & 6) == 6; //Registres sauvs par le systme
+		return avx2 ? AVX2 : (sse2 ? SSE2 : SCALAIRE);
+#elif defined(LOT_SIMILITUDE_X86) && defined(__GNUC__)
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+			return AVX2;
+		if (__builtin_cpu_supports("sse2"))
+			return SSE2;
+		return SCALAIRE;
+#else
+		return SCALAIRE;
+#endif
+	}
+
+}//Fin du namespace
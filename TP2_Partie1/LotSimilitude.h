@@ -0,0 +1,126 @@
+/**
+ * \file LotSimilitude.h
+ * \brief Ce fichier contient l'interface du calcul de similitude d'un mot contre plusieurs mots.
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+
+
+#ifndef LOT_SIMILITUDE_H_
+#define LOT_SIMILITUDE_H_
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+
+namespace TP2P1
+{
+/**
+* \class LotSimilitude
+*
+* \brief Calcul de Dictionnaire::similitude entre une requte et un lot de mots candidats
+*
+*  Pour deux mots d'au plus 64 lettres, le calcul est fait en parallle sur les bits: pour
+*  chaque lettre p du plus grand mot, un masque de 64 bits indique les positions j du plus
+*  petit mot o commence un sous-mot de longueur L gal  bigger[p..p+L). Passer de L  L+1
+*  est un ET avec le masque de la lettre p+L dcal de L bits; le OU de tous les masques
+*  donne les sous-mots de longueur L trouvs. Ces tours sont faits 2 ou 4 masques  la fois
+*  (SSE2 ou AVX2, choisi  l'excution selon le processeur, sinon en C++ ordinaire).
+*
+*  La table des masques de la requte est prpare une seule fois pour tout le lot. Les mots
+*  plus longs passent par le calcul gnral, similitude().
+*/
+class LotSimilitude
+{
+public:
+
+	/*
+	*\brief		Le jeu d'instructions utilis pour les calculs sur les masques
+	*/
+	enum JeuInstructions
+	{
+		SCALAIRE,
+		SSE2,
+		AVX2
+	};
+
+	/*
+	*\brief		Prparer une requte
+	*
+	*\pre		La chane vise par requete existe tant que l'instance est utilise
+	*
+	*\post		L'instance peut noter des lots de candidats contre la requte
+	*
+	*/
+	explicit LotSimilitude(std::string_view requete);
+
+	/*
+	*\brief		Noter un lot de candidats
+	*
+	*\post		scores[i] vaut exactement Dictionnaire::similitude(candidats[i], requete)
+	*
+	*/
+	void noter(const std::string_view *candidats, size_t nbCandidats, double *scores) const;
+
+	/*
+	*\brief		Le calcul gnral de la similitude, pour des mots de toute longueur
+	*
+	*\post		On retourne la valeur dfinie par Dictionnaire::similitude(), en O(L) et sans allocation
+	*
+	*/
+	static double similitude(std::string_view mot1, std::string_view mot2);
+
+	/*
+	*\brief		Le jeu d'instructions choisi pour ce processeur
+	*
+	*/
+	static JeuInstructions jeuInstructions();
+
+	/*
+	*\brief		Forcer un jeu d'instructions (pour comparer les versions entre elles)
+	*			L'appel est sr pendant que d'autres threads notent des candidats; chaque candidat
+	*			est not au complet avec l'ancien ou le nouveau jeu
+	*
+	*\post		Si le processeur ne le supporte pas, on garde le choix courant
+	*
+	*/
+	static void choisirJeuInstructions(JeuInstructions jeu);
+
+private:
+
+   static const size_t TAILLE_MAX = 64;		// La longueur maximale traite par masques de 64 bits
+
+   static const size_t TAILLE_TRANCHE = 64;	// Le nombre de lettres traites  la fois par similitude()
+
+   std::string_view requete;					// La requte
+
+   uint64_t masquesRequete[256];			// Pour chaque caractre, les positions o il apparat dans la requte
+
+   /*
+	*\brief		Noter un candidat d'au plus TAILLE_MAX lettres quand la requte en a aussi au plus TAILLE_MAX
+	*
+	*\pre		masquesCandidat est rempli de zros
+	*
+	*\post		masquesCandidat est remis  zro
+	*
+	*/
+   double _noterCourt(std::string_view candidat, uint64_t *masquesCandidat) const;
+
+   /*
+	*\brief		Le jeu d'instructions courant (dtect au premier appel), lu et chang sans verrou
+	*/
+   static std::atomic<JeuInstructions> &_jeuCourant();
+
+   /*
+	*\brief		Le meilleur jeu d'instructions support par le processeur
+	*/
+   static JeuInstructions _detecter();
+};
+
+}
+
+#endif /* LOT_SIMILITUDE_H_ */
@@ -0,0 +1,115 @@
+/**
+ * \file MeilleursCandidats.cpp
+ * \brief Ce fichier contient une implantation des mthodes de la classe MeilleursCandidats
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+#include "MeilleursCandidats.h"
+#include <algorithm>
+namespace TP2P1
+{
+
+	/**
+	 * \fn MeilleursCandidats::MeilleursCandidats(unsigned int nbMax, double seuil)
+	 * \param[in] nbMax : Le nombre maximal de candidats retenus
+	 * \param[in] seuil : Le score  dpasser
+	 */
+	MeilleursCandidats::MeilleursCandidats(unsigned int nbMax, double seuil) : nbMax(nbMax), seuil(seuil)
+	{
+		tas.reserve(nbMax < RESERVE_MAX ? nbMax : RESERVE_MAX);
+	}
+
+	/**
+	 * \fn void MeilleursCandidats::proposer(double score, std::string_view mot)
+	 * \param[in] score : Le score du candidat
+	 * \param[in] mot : Le candidat
+	 */
+	void MeilleursCandidats::proposer(double score, std::string_view mot)
+	{
+		if (!(score > seuil) || nbMax == 0)
+			return;
+
+		if (tas.size() < nbMax)
+		{
+			tas.push_back(Candidat(score, std::string(mot)));
+			std::push_heap(tas.begin(), tas.end(), _plusFort);
+			return;
+		}
+
+		//La slection est pleine: on ne compare qu'avec le plus faible
+		const Candidat &plusFaible = tas.front();
+		if (score < plusFaible.first || (score == plusFaible.first && mot >= plusFaible.second))
+			return;
+
+		std::pop_heap(tas.begin(), tas.end(), _plusFort);
+		tas.back().first = score;
+		tas.back().second.assign(mot.data(), mot.size());
+		std::push_heap(tas.begin(), tas.end(), _plusFort);
+	}
+
+	/**
+	 * \fn void MeilleursCandidats::fusionner(const MeilleursCandidats &autre)
+	 * \param[in] autre : L'autre slection
+	 */
+	void MeilleursCandidats::fusionner(const MeilleursCandidats &autre)
+	{
+		for (size_t i = 0; i < autre.tas.size(); i++)
+			proposer(autre.tas[i].first, autre.tas[i].second);
+	}
+
+	/**
+	 * \fn std::vector<std::string> MeilleursCandidats::resultats() const
+	 */
+	std::vector<std::string> MeilleursCandidats::resultats() const
+	{
+		std::vector<Candidat> tries(tas);
+		std::sort(tries.begin(), tries.end(), _plusFort);
+
+		std::vector<std::string> mots;
+		mots.reserve(tries.size());
+		for (size_t i = 0; i < tries.size(); i++)
+			mots.push_back(tries[i].second);
+		return mots;
+	}
+
+	/**
+	 * \fn size_t MeilleursCandidats::taille() const
+	 */
+	size_t MeilleursCandidats::taille() const
+	{
+		return tas.size();
+	}
+
+	/**
+	 * \fn unsigned int MeilleursCandidats::capacite() const
+	 */
+	unsigned int MeilleursCandidats::capacite() const
+	{
+		return nbMax;
+	}
+
+	/**
+	 * \fn double MeilleursCandidats::seuilSelection() const
+	 */
+	double MeilleursCandidats::seuilSelection() const
+	{
+		return seuil;
+	}
+
+	/**
+	 * \fn bool MeilleursCandidats::_plusFort(const Candidat &a, const Candidat &b)
+	 * \param[in] a : Premier candidat
+	 * \param[in] b : Deuxime candidat
+	 *
+	 * Utilis comme comparaison du tas, ce critre place le candidat le plus faible au sommet.
+	 */
+	bool MeilleursCandidats::_plusFort(const Candidat &a, const Candidat &b)
+	{
+		if (a.first != b.first)
+			return a.first > b.first;
+		return a.second < b.second;
+	}
+
+}//Fin du namespace
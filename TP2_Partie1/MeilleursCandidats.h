@@ -0,0 +1,107 @@
+/**
+ * \file MeilleursCandidats.h
+ * \brief Ce fichier contient l'interface d'une slection borne des meilleurs candidats.
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+
+
+#ifndef MEILLEURS_CANDIDATS_H_
+#define MEILLEURS_CANDIDATS_H_
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
+
+namespace TP2P1
+{
+/**
+* \class MeilleursCandidats
+*
+* \brief Garde les K candidats les mieux nots au-dessus d'un seuil
+*
+*  Les candidats retenus forment un tas dont le sommet est le plus faible: un nouveau
+*  candidat est compar  ce sommet seulement, en O(1), et le remplace en O(log K).
+*   score gal, le mot le plus petit en ordre alphabtique l'emporte; le rsultat ne
+*  dpend donc pas de l'ordre dans lequel les candidats sont proposs.
+*/
+class MeilleursCandidats
+{
+public:
+
+	/*
+	*\brief		Constructeur
+	*
+	*\post		Une slection vide de capacit nbMax a t initialise
+	*
+	*/
+	MeilleursCandidats(unsigned int nbMax, double seuil);
+
+	static const unsigned int RESERVE_MAX = 64;	// Nombre maximal de places rserves d'avance; nbMax peut valoir UINT_MAX
+
+	/*
+	*\brief		Proposer un candidat avec son score
+	*
+	*\post		Le candidat est retenu si son score dpasse le seuil et qu'il est parmi les nbMax meilleurs
+	*
+	*\exception	bad_alloc s'il n'y a pas assez de mmoire
+	*
+	*/
+	void proposer(double score, std::string_view mot);
+
+	/*
+	*\brief		Ajouter les candidats retenus par une autre slection
+	*
+	*\post		La slection contient les meilleurs candidats des deux slections
+	*
+	*/
+	void fusionner(const MeilleursCandidats &autre);
+
+	/*
+	*\brief		Donne les mots retenus, du meilleur au moins bon
+	*
+	*\post		La slection est inchange
+	*
+	*/
+	std::vector<std::string> resultats() const;
+
+	/*
+	*\brief		Donne le nombre de candidats retenus
+	*
+	*/
+	size_t taille() const;
+
+	/*
+	*\brief		Donne le nombre maximal de candidats retenus
+	*
+	*/
+	unsigned int capacite() const;
+
+	/*
+	*\brief		Donne le score  dpasser pour tre retenu
+	*
+	*/
+	double seuilSelection() const;
+
+private:
+
+   typedef std::pair<double, std::string> Candidat;	// Un score et son mot
+
+   std::vector<Candidat> tas;	// Les candidats retenus; tas[0] est le plus faible
+
+   unsigned int nbMax;			// Le nombre maximal de candidats retenus
+
+   double seuil;				// Le score  dpasser pour tre retenu
+
+   /*
+	*\brief		Vrai si a passe avant b: meilleur score, puis ordre alphabtique
+	*/
+   static bool _plusFort(const Candidat &a, const Candidat &b);
+};
+
+}
+
+#endif /* MEILLEURS_CANDIDATS_H_ */
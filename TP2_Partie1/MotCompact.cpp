@@ -0,0 +1,139 @@
+/**
+ * \file MotCompact.cpp
+ * \brief Ce fichier contient une implantation des mthodes de la classe MotCompact
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+#include "MotCompact.h"
+#include <string.h>
+#include <stdexcept>
+namespace TP2P1
+{
+
+	/**
+	 * \fn MotCompact::MotCompact()
+	 */
+	MotCompact::MotCompact()
+	{
+		memset(octets, 0, sizeof(octets));
+	}
+
+	/**
+	 * \fn MotCompact::MotCompact(std::string_view mot)
+	 * \param[in] mot : Le mot  garder
+	 */
+	MotCompact::MotCompact(std::string_view mot)
+	{
+		memset(octets, 0, sizeof(octets));
+		if (mot.size() <= TAILLE_INTERNE)
+		{
+			if (!mot.empty())
+				memcpy(octets, mot.data(), mot.size());
+			octets[15] = static_cast<char>(mot.size());
+			return;
+		}
+
+		if (mot.size() > UINT32_MAX)
+			throw std::length_error("MotCompact: le mot est trop long\n");
+
+		char * externe = new char[mot.size()];
+		memcpy(externe, mot.data(), mot.size());
+		uint32_t longueur = static_cast<uint32_t>(mot.size());
+		memcpy(octets, &externe, sizeof(externe));
+		memcpy(octets + sizeof(externe), &longueur, sizeof(longueur));
+		octets[15] = static_cast<char>(LONG);
+	}
+
+	/**
+	 * \fn MotCompact::MotCompact(MotCompact &&autre)
+	 * \param[in,out] autre : Le mot  dplacer, laiss vide
+	 */
+	MotCompact::MotCompact(MotCompact &&autre) noexcept
+	{
+		memcpy(octets, autre.octets, sizeof(octets));
+		memset(autre.octets, 0, sizeof(autre.octets));
+	}
+
+	/**
+	 * \fn MotCompact & MotCompact::operator=(MotCompact &&autre)
+	 * \param[in,out] autre : Le mot  dplacer, laiss vide
+	 */
+	MotCompact & MotCompact::operator=(MotCompact &&autre) noexcept
+	{
+		if (this != &autre)
+		{
+			MotCompact vide;
+			swap(autre);
+			autre.swap(vide);
+		}
+		return *this;
+	}
+
+	/**
+	 * \fn MotCompact::~MotCompact()
+	 */
+	MotCompact::~MotCompact()
+	{
+		if (_estLong())
+		{
+			char * externe;
+			memcpy(&externe, octets, sizeof(externe));
+			delete [] externe;
+		}
+	}
+
+	/**
+	 * \fn std::string_view MotCompact::vue() const
+	 */
+	std::string_view MotCompact::vue() const
+	{
+		if (!_estLong())
+			return std::string_view(octets, static_cast<unsigned char>(octets[15]));
+
+		const char * externe;
+		uint32_t longueur;
+		memcpy(&externe, octets, sizeof(externe));
+		memcpy(&longueur, octets + sizeof(externe), sizeof(longueur));
+		return std::string_view(externe, longueur);
+	}
+
+	/**
+	 * \fn size_t MotCompact::size() const
+	 */
+	size_t MotCompact::size() const
+	{
+		return vue().size();
+	}
+
+	/**
+	 * \fn int MotCompact::compare(std::string_view autre) const
+	 * \param[in] autre : Le mot  comparer
+	 */
+	int MotCompact::compare(std::string_view autre) const
+	{
+		return vue().compare(autre);
+	}
+
+	/**
+	 * \fn void MotCompact::swap(MotCompact &autre)
+	 * \param[in,out] autre : Le mot  changer
+	 */
+	void MotCompact::swap(MotCompact &autre) noexcept
+	{
+		char temp[sizeof(octets)];
+		memcpy(temp, octets, sizeof(octets));
+		memcpy(octets, autre.octets, sizeof(octets));
+		memcpy(autre.octets, temp, sizeof(octets));
+	}
+
+	/**
+	 * \fn bool MotCompact::_estLong() const
+	 */
+	bool MotCompact::_estLong() const
+	{
+		return static_cast<unsigned char>(octets[15]) == LONG;
+	}
+
+}
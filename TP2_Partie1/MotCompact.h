@@ -0,0 +1,98 @@
+/**
+ * \file MotCompact.h
+ * \brief Ce fichier contient l'interface d'un mot rang sur 16 octets.
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+
+
+#ifndef MOT_COMPACT_H_
+#define MOT_COMPACT_H_
+
+#include <string_view>
+#include <cstdint>
+
+namespace TP2P1
+{
+/**
+* \class MotCompact
+*
+* \brief Un mot qui tient sur 16 octets, gard dans le noeud s'il est court
+*
+*  Un mot d'au plus TAILLE_INTERNE caractres est rang dans le mot lui-mme et sa longueur
+*  dans le dernier octet. Un mot plus long est allou  part: on garde alors un pointeur et
+*  sa longueur, et le dernier octet vaut LONG.
+*/
+class MotCompact
+{
+public:
+
+	/*
+	*\brief		Constructeur d'un mot vide
+	*
+	*/
+	MotCompact();
+
+	/*
+	*\brief		Constructeur
+	*
+	*\post		vue() == mot
+	*
+	*\exception	bad_alloc si le mot est long et qu'il n'y a pas assez de mmoire
+	*\exception	length_error si le mot a plus de UINT32_MAX caractres
+	*
+	*/
+	explicit MotCompact(std::string_view mot);
+
+	MotCompact(MotCompact &&autre) noexcept;
+
+	MotCompact & operator=(MotCompact &&autre) noexcept;
+
+	~MotCompact();
+
+	/*
+	*\brief		Donne le mot
+	*
+	*\post		La vue reste valide tant que le mot n'est ni modifi ni dplac
+	*
+	*/
+	std::string_view vue() const;
+
+	/*
+	*\brief		Donne le nombre de caractres du mot
+	*
+	*/
+	size_t size() const;
+
+	/*
+	*\brief		Compare avec un autre mot, comme std::string::compare
+	*
+	*/
+	int compare(std::string_view autre) const;
+
+	/*
+	*\brief		changer deux mots, sans allocation
+	*
+	*/
+	void swap(MotCompact &autre) noexcept;
+
+	static const size_t TAILLE_INTERNE = 15;	// Le nombre maximal de caractres gards dans le mot lui-mme
+
+private:
+
+   static const unsigned char LONG = 0xFF;	// Le dernier octet d'un mot allou  part
+
+   char octets[16];		// Les caractres et la longueur, ou un pointeur et la longueur
+
+   bool _estLong() const;
+
+   // Un mot ne se copie pas: il se dplace
+   MotCompact(const MotCompact &);
+   MotCompact & operator=(const MotCompact &);
+};
+
+}
+
+#endif /* MOT_COMPACT_H_ */
@@ -9,17 +9,24 @@
 
 #include <iostream>
 #include <iomanip>
+#include <stdexcept>
 using namespace std;
 
 #include "Dictionnaire.h"
+#include "DictionnaireFige.h"
+#include "TraducteurTexte.h"
 using namespace TP2P1;
 
 	#define MAX_MOT 40
 	#define MAX_PHRASE 100
+	#define MAX_COMPLETIONS 10
 
 
 
-void TraiterMot(Dictionnaire & dico,std::string & token,std::vector<std::string> & phrase);
+template <typename D> int Interface(D & dico);
+template <typename D> void TraiterMot(D & dico,std::string & token,std::vector<std::string> & phrase);
+void Sauvegarder(const Dictionnaire & dico,const std::string & nomFichier);
+void Sauvegarder(const DictionnaireFige & dico,const std::string & nomFichier);
 /**
  * \fn int main()
  * \brief Fonction principale pour tester le dictionnaire.
@@ -28,19 +35,42 @@ void TraiterMot(Dictionnaire & dico,std::string & token,std::vector<std::string>
  */
 int main()
 {
-	std::ifstream in;
-	
-	
 	char fichier[MAX_PHRASE];
 	//Ouverture du dictionnaire
 	std::cout << "Entrez le nom du fichier du dictionnaire : ";
 	std::cin>>fichier; 
 	
-	in.open(fichier);
-	if(in.fail()) { std::cout<<" \n Erreur dans l'ouverture du fichier \n\n";  return 1;}
-	Dictionnaire dico = Dictionnaire(in);
+	//Une image est d'abord lue en entier par verifierSomme(), puis par recherche binaire: pas de conseil
+	FichierMappe in(fichier, FichierMappe::ACCES_NORMAL);
+	if(!in.estOuvert()) { std::cout<<" \n Erreur dans l'ouverture du fichier \n\n";  return 1;}
 
-	
+	//Une image binaire sert directement, sans analyser le texte ni reconstruire l'arbre
+	if(DictionnaireFige::estImage(in.contenu())){
+		try {
+			DictionnaireFige dico(in);
+			//Le constructeur ne lit que l'en-tte: on vrifie tout le tampon avant de s'en servir
+			if(!dico.verifierSomme())
+				throw std::runtime_error("DictionnaireFige: somme de contrle invalide, image corrompue");
+			return Interface(dico);
+		}
+		catch (std::runtime_error & e) { std::cout<<" \n "<<e.what()<<"\n";  return 1;}
+	}
+
+	//Un texte est analys du dbut  la fin: il est projet de nouveau en accs squentiel
+	FichierMappe texte(fichier, FichierMappe::ACCES_SEQUENTIEL);
+	Dictionnaire dico(texte);
+	return Interface(dico);
+}
+
+/**
+ * \fn int Interface(D & dico)
+ * \brief Menu principal, pour un Dictionnaire ou un DictionnaireFige.
+ * \param[in] dico : Dictionnaire utilis
+ *
+ * \return 0 - Arrt normal du programme.
+ */
+template <typename D> int Interface(D & dico)
+{
 	//Interface principale
 	while(true){
 		string comm;
@@ -48,6 +78,9 @@ int main()
 		std::cout<<"\n\n\n\n\n";
 		std::cout << "0 : Quitter "<<std::endl;
 		std::cout << "1 : Traduire une phrase "<<std::endl;
+		std::cout << "2 : Enregistrer l'image binaire du dictionnaire "<<std::endl;
+		std::cout << "3 : Traduire un fichier texte, mot  mot "<<std::endl;
+		std::cout << "4 : Complter un dbut de mot "<<std::endl;
 	
 
 		cin>>comm;
@@ -59,30 +92,58 @@ int main()
 		else if (comm == "1") {
 				string phrase;
 				std::vector<std::string> phraseTraduite;
-				string delimiter = " ";
 
 				std::cout<<"\n\n Entrez une phrase  traduire : ";
 				cin.ignore();
 				getline(std::cin, phrase);
 
-				size_t pos = 0;
-				std::string token;
-				 //On analyse chaque mot
-				while ((pos = phrase.find(delimiter)) != std::string::npos) {
-					token = phrase.substr(0, pos);
-
+				 //On analyse chaque mot, en une seule passe sur la phrase
+				std::string_view reste = phrase;
+				std::string_view mot;
+				while (TraducteurTexte<D>::motSuivant(reste, mot)) {
+					std::string token(mot);
 					TraiterMot(dico,token,phraseTraduite);
-						
-					phrase.erase(0, pos + delimiter.length());
 				}
-				//Dernier mot
-				TraiterMot(dico,phrase,phraseTraduite);
 				std::cout<<"\n\n Voici le texte traduit en franais : ";
 				for(int i = 0; i < phraseTraduite.size();i++){
 					std::cout<<phraseTraduite.at(i)<<" ";
 				}
 					
 		}
+		else if (comm == "2") {
+				string nomImage;
+				std::cout<<"\n\n Entrez le nom du fichier de l'image : ";
+				cin>>nomImage;
+				try {
+					Sauvegarder(dico,nomImage);
+					std::cout<<"\n\n Image enregistre.";
+				}
+				catch (std::runtime_error & e) { std::cout<<"\n\n "<<e.what();}
+		}
+		else if (comm == "3") {
+				string nomTexte;
+				std::cout<<"\n\n Entrez le nom du fichier  traduire : ";
+				cin>>nomTexte;
+				FichierMappe texte(nomTexte);
+				if(!texte.estOuvert()) { std::cout<<"\n\n Erreur dans l'ouverture du fichier";}
+				else {
+					std::cout<<"\n\n";
+					dico.traduireTexte(texte.contenu(), std::cout);
+				}
+		}
+		else if (comm == "4") {
+				string prefixe;
+				std::cout<<"\n\n Entrez le dbut du mot : ";
+				cin>>prefixe;
+				typename D::Parcours parcours = dico.motsAvecPrefixe(prefixe, MAX_COMPLETIONS);
+				std::string_view mot;
+				while (parcours.suivant(mot)) {
+					VueTraductions traductions = parcours.traductions();
+					std::cout<<"\n "<<mot;
+					if (!traductions.empty())
+						std::cout<<" : "<<traductions[0];
+				}
+		}
 		else{
 			std::cout<<"\n\n Commande invalide...";
 		}
@@ -94,17 +155,39 @@ int main()
 }
 
 /**
- * \fn void TraiterMot(Dictionnaire & dico,std::string & token,std::vector<std::string> & phrase)
+ * \fn void Sauvegarder(const Dictionnaire & dico,const std::string & nomFichier)
+ * \param[in] dico : Dictionnaire  enregistrer
+ * \param[in] nomFichier : Fichier de l'image
+ */
+void Sauvegarder(const Dictionnaire & dico,const std::string & nomFichier)
+{
+	DictionnaireFige(dico).sauvegarder(nomFichier);
+}
+
+/**
+ * \fn void Sauvegarder(const DictionnaireFige & dico,const std::string & nomFichier)
+ * \param[in] dico : Dictionnaire  enregistrer
+ * \param[in] nomFichier : Fichier de l'image
+ */
+void Sauvegarder(const DictionnaireFige & dico,const std::string & nomFichier)
+{
+	dico.sauvegarder(nomFichier);
+}
+
+/**
+ * \fn void TraiterMot(D & dico,std::string & token,std::vector<std::string> & phrase)
  * \param[in] dico : Dictionnaire utilis
  * \param[in] token : mot qui sera trait
   * \param[in] phrase : phrase finale
  */
-void TraiterMot(Dictionnaire & dico,std::string & token,std::vector<std::string> & phrase)
+template <typename D> void TraiterMot(D & dico,std::string & token,std::vector<std::string> & phrase)
 {
 	
 	int comm;
+	//Une seule recherche dit si le mot est dans le dictionnaire et donne ses traductions
+	VueTraductions traductions = dico.vueTraductions(token);
 	//Si le mot n'est pas dans le dictionnaire
-	if(!dico.appartient(token)){
+	if(!traductions.trouve()){
 		bool valid = false;
 		std::vector<std::string> corrections = dico.suggereCorrections(token);
 		std::cout<<"\n\n Mot introuvable : "<<token<<std::endl;
@@ -124,14 +207,12 @@ void TraiterMot(Dictionnaire & dico,std::string & token,std::vector<std::string>
 				std::cin.ignore(32999,'\n');}
 
 		}
-		 
-		
+		traductions = dico.vueTraductions(token);
 	}
 	//On s'assure que le mot est dans le dictionnaire
-	if(dico.appartient(token)){
+	if(traductions.trouve()){
 		bool valid = false;			 
 		std::cout<<"\n\n Plusieurs actions sont possibles pour le mot "<<token<<" : "<<std::endl;
-		std::vector<std::string> traductions = dico.traduit(token);
 		for(int i =0;i < traductions.size();i++){
 			std::cout<<"\n"<<i<<". "<<traductions.at(i)<<" : "<<std::endl;
 		}
@@ -141,13 +222,13 @@ void TraiterMot(Dictionnaire & dico,std::string & token,std::vector<std::string>
 				valid = true;
 				std::cout<<"\nVotre choix : ";
 				std::cin>>comm;
-				token = traductions.at(comm); 
+				token = traductions.at(comm);
 
 			}
 			catch (...) { cout << "Commande invalide..."; valid = false;cin.clear();
 				std::cin.ignore(32999,'\n');}
 		}
 		//On ajoute la traduction choisie a la liste
-		phrase.push_back(traductions.at(comm));
+		phrase.push_back(token);
 	}
 }
@@ -0,0 +1,112 @@
+/**
+ * \file TableChaines.cpp
+ * \brief Ce fichier contient une implantation des mthodes de la classe TableChaines
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+#include "TableChaines.h"
+#include <stdexcept>
+#include <functional>
+namespace TP2P1
+{
+
+	/**
+	 * \fn TableChaines::TableChaines()
+	 */
+	TableChaines::TableChaines() : debuts(1, 0)
+	{
+	}
+
+	/**
+	 * \fn uint32_t TableChaines::interner(std::string_view chaine)
+	 * \param[in] chaine : La chane  trouver ou  ajouter
+	 */
+	uint32_t TableChaines::interner(std::string_view chaine)
+	{
+		if (!cases.empty())
+		{
+			size_t c = _case(chaine);
+			if (cases[c] != VIDE)
+				return cases[c];
+		}
+
+		if (chaine.size() > UINT32_MAX - reserve.size())
+			throw std::length_error("TableChaines: la reserve est trop grosse\n");
+
+		//On garde la table au plus  moiti pleine
+		if (2 * debuts.size() > cases.size())
+			_agrandir();
+
+		//Si un ajout choue, la chane n'est pas dans la table
+		size_t taille = reserve.size();
+		reserve.insert(reserve.end(), chaine.begin(), chaine.end());
+		try
+		{
+			debuts.push_back(static_cast<uint32_t>(reserve.size()));
+		}
+		catch (...)
+		{
+			reserve.resize(taille);
+			throw;
+		}
+
+		uint32_t id = static_cast<uint32_t>(debuts.size() - 2);
+		cases[_case(chaine)] = id;
+		return id;
+	}
+
+	/**
+	 * \fn std::string_view TableChaines::chaine(uint32_t id) const
+	 * \param[in] id : Un identifiant donn par interner()
+	 */
+	std::string_view TableChaines::chaine(uint32_t id) const
+	{
+		return std::string_view(reserve.data() + debuts[id], debuts[id + 1] - debuts[id]);
+	}
+
+	/**
+	 * \fn size_t TableChaines::taille() const
+	 */
+	size_t TableChaines::taille() const
+	{
+		return debuts.size() - 1;
+	}
+
+	/**
+	 * \fn void TableChaines::ajuster()
+	 */
+	void TableChaines::ajuster()
+	{
+		reserve.shrink_to_fit();
+		debuts.shrink_to_fit();
+	}
+
+	/**
+	 * \fn size_t TableChaines::_case(std::string_view chaine) const
+	 * \param[in] chaine : La chane cherche
+	 *
+	 * On essaie les cases suivantes une  une; la table n'est jamais pleine.
+	 */
+	size_t TableChaines::_case(std::string_view chaine) const
+	{
+		size_t masque = cases.size() - 1;
+		size_t c = std::hash<std::string_view>()(chaine) & masque;
+		while (cases[c] != VIDE && this->chaine(cases[c]) != chaine)
+			c = (c + 1) & masque;
+		return c;
+	}
+
+	/**
+	 * \fn void TableChaines::_agrandir()
+	 */
+	void TableChaines::_agrandir()
+	{
+		std::vector<uint32_t> anciennes(cases.empty() ? 16 : 2 * cases.size(), VIDE);
+		anciennes.swap(cases);
+		for (uint32_t id = 0; id < taille(); id++)
+			cases[_case(chaine(id))] = id;
+	}
+
+}
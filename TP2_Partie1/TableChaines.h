@@ -0,0 +1,90 @@
+/**
+ * \file TableChaines.h
+ * \brief Ce fichier contient l'interface d'une table de chanes uniques (internement).
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+
+
+#ifndef TABLE_CHAINES_H_
+#define TABLE_CHAINES_H_
+
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+namespace TP2P1
+{
+/**
+* \class TableChaines
+*
+* \brief Garde une seule copie de chaque chane et la dsigne par un identifiant de 32 bits
+*
+*  Les caractres sont rangs bout  bout dans une seule rserve, comme dans DictionnaireFige,
+*  et la recherche se fait dans une table de hachage  adressage ouvert qui ne contient que
+*  les identifiants. Une chane n'est jamais retire, mme si plus personne ne l'utilise.
+*/
+class TableChaines
+{
+public:
+
+	TableChaines();
+
+	/*
+	*\brief		Donne l'identifiant d'une chane, en l'ajoutant  la table au besoin
+	*
+	*\post		chaine(interner(s)) == s
+	*
+	*\exception	bad_alloc s'il n'y a pas assez de mmoire
+	*\exception	length_error si la rserve dpasse UINT32_MAX caractres
+	*
+	*/
+	uint32_t interner(std::string_view chaine);
+
+	/*
+	*\brief		Donne la chane d'un identifiant
+	*
+	*\pre		L'identifiant a t donn par interner()
+	*\post		La chane reste valide jusqu'au prochain interner()
+	*
+	*/
+	std::string_view chaine(uint32_t id) const;
+
+	/*
+	*\brief		Donne le nombre de chanes diffrentes
+	*
+	*/
+	size_t taille() const;
+
+	/*
+	*\brief		Rendre la capacit inutilise de la rserve, par exemple aprs un chargement
+	*
+	*/
+	void ajuster();
+
+private:
+
+   std::vector<char> reserve;		// Les chanes, bout  bout
+
+   std::vector<uint32_t> debuts;	// [taille()+1] La position de chaque chane dans la rserve
+
+   std::vector<uint32_t> cases;	// La table de hachage: un identifiant ou VIDE; sa taille est une puissance de 2
+
+   static constexpr uint32_t VIDE = UINT32_MAX;	// Une case libre de la table de hachage
+
+   /*
+	*\brief		Donne la case d'une chane: celle qui contient son identifiant, ou la case vide o le mettre
+	*/
+   size_t _case(std::string_view chaine) const;
+
+   /*
+	*\brief		Doubler la table de hachage et y replacer tous les identifiants
+	*/
+   void _agrandir();
+};
+
+}
+
+#endif /* TABLE_CHAINES_H_ */
@@ -0,0 +1,126 @@
+/**
+ * \file TestAVL.cpp
+ * \brief Test de contrainte de l'arbre AVL de Dictionnaire
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ * Un million d'oprations au hasard (ajouts, suppressions, lots fusionns, recherches) sont
+ * faites  la fois sur un Dictionnaire et sur une std::map de rfrence. Toutes les 1000
+ * oprations, verifierInvariants() contrle l'ordre des mots, chaque hauteur, l'quilibre de
+ * chaque noeud et le compte des mots; chaque recherche est compare  la rfrence.
+ *
+ *    g++ -std=c++17 -O2 -pthread TestAVL.cpp $(ls *.cpp | grep -v -e Principal -e Banc -e Test)
+ */
+
+#include <iostream>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Dictionnaire.h"
+#include "LotDictionnaire.h"
+using namespace TP2P1;
+
+/**
+ * \fn int main()
+ * \brief Fait les oprations et affiche la premire incohrence.
+ *
+ * \return 0 si l'arbre est rest valide et conforme  la rfrence, 1 sinon.
+ */
+int main()
+{
+	std::mt19937 generateur(2014);
+
+	// Peu de mots diffrents, pour que les ajouts et les suppressions tombent souvent sur les mmes
+	std::vector<std::string> mots(20000);
+	for (size_t i = 0; i < mots.size(); i++)
+	{
+		mots[i].resize(1 + generateur() % 8);
+		for (size_t j = 0; j < mots[i].size(); j++)
+			mots[i][j] = static_cast<char>('a' + generateur() % 6);
+	}
+
+	Dictionnaire dico;
+	std::map<std::string, std::vector<std::string> > reference;
+	const int NB_OPERATIONS = 1000000;
+	int nbVerifications = 0;
+
+	try
+	{
+		for (int operation = 1; operation <= NB_OPERATIONS; operation++)
+		{
+			const std::string &mot = mots[generateur() % mots.size()];
+			std::string traduction = "t" + std::to_string(generateur() % 100);
+			unsigned int choix = generateur() % 1000;
+
+			if (choix < 450)
+			{
+				dico.ajouteMot(mot, traduction);
+				reference[mot].push_back(traduction);
+			}
+			else if (choix < 800)
+			{
+				bool present = reference.erase(mot) != 0;
+				bool supprime = true;
+				try { dico.supprimeMot(mot); }
+				catch (std::logic_error &) { supprime = false; }
+				if (supprime != present)
+					throw std::logic_error("supprimeMot ne suit pas la reference pour " + mot);
+			}
+			else if (choix < 999)
+			{
+				std::map<std::string, std::vector<std::string> >::const_iterator trouve = reference.find(mot);
+				std::vector<std::string> attendu = trouve == reference.end() ? std::vector<std::string>() : trouve->second;
+				if (dico.appartient(mot) != (trouve != reference.end()) || dico.traduit(mot) != attendu)
+					throw std::logic_error("recherche differente de la reference pour " + mot);
+			}
+			else
+			{
+				// Un lot, fusionn en une passe ou mot par mot selon sa taille
+				std::string texte;
+				size_t taille = 1 + generateur() % 3000;
+				for (size_t i = 0; i < taille; i++)
+				{
+					const std::string &motLot = mots[generateur() % mots.size()];
+					std::string traductionLot = "l" + std::to_string(generateur() % 100);
+					texte += motLot + '\t' + traductionLot + '\n';
+				}
+				LotDictionnaire lot;
+				lot.ajouterTexte(texte);
+				dico.fusionner(lot);
+				for (size_t i = 0; i < lot.paires().size(); i++)
+					reference[std::string(lot.paires()[i].first)].push_back(std::string(lot.paires()[i].second));
+			}
+
+			if (operation % 1000 == 0)
+			{
+				dico.verifierInvariants();
+				nbVerifications++;
+			}
+		}
+
+		// Tout vider, en ordre, pour finir sur la pire suite de rotations
+		while (!reference.empty())
+		{
+			dico.supprimeMot(reference.begin()->first);
+			reference.erase(reference.begin());
+			if (reference.size() % 100 == 0)
+				dico.verifierInvariants();
+		}
+		dico.verifierInvariants();
+		for (size_t i = 0; i < mots.size(); i++)
+			if (dico.appartient(mots[i]))
+				throw std::logic_error("le dictionnaire n'est pas vide apres avoir tout supprime");
+	}
+	catch (std::exception &e)
+	{
+		std::cout << "Echec apres " << nbVerifications << " verifications : " << e.what() << std::endl;
+		return 1;
+	}
+
+	std::cout << NB_OPERATIONS << " operations, " << nbVerifications << " verifications des invariants, aucune erreur" << std::endl;
+	return 0;
+}
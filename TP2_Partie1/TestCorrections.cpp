@@ -0,0 +1,92 @@
+/**
+ * \file TestCorrections.cpp
+ * \brief Test de non-rgression: DictionnaireFige::suggereCorrections() contre Dictionnaire
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ * Charge EnglishFrench.txt dans un Dictionnaire et dans sa copie fige, puis demande des
+ * corrections aux deux pour des mots du dictionnaire modifis au hasard (1  5 lettres
+ * remplaces, ajoutes ou enleves) et pour des mots sans rapport: les listes doivent tre
+ * exactement les mmes, pour plusieurs nombres de corrections.
+ *
+ *    g++ -std=c++17 -O2 -pthread TestCorrections.cpp $(ls *.cpp | grep -v -e Principal -e Banc -e Test)
+ */
+
+#include <climits>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Dictionnaire.h"
+#include "DictionnaireFige.h"
+using namespace TP2P1;
+
+/**
+ * \fn std::string modifier(std::string mot, std::mt19937 &generateur)
+ * \brief Applique au mot de 1  5 modifications d'une lettre.
+ */
+static std::string modifier(std::string mot, std::mt19937 &generateur)
+{
+	int nbModifications = 1 + generateur() % 5;
+	for (int i = 0; i < nbModifications; i++)
+	{
+		char lettre = static_cast<char>('a' + generateur() % 26);
+		size_t position = mot.empty() ? 0 : generateur() % mot.size();
+		switch (generateur() % 3)
+		{
+		case 0: if (!mot.empty()) mot[position] = lettre; break;
+		case 1: mot.insert(mot.begin() + position, lettre); break;
+		default: if (mot.size() > 1) mot.erase(position, 1); break;
+		}
+	}
+	return mot;
+}
+
+/**
+ * \fn int main()
+ * \brief Compare les corrections des deux dictionnaires et affiche les mots qui diffrent.
+ *
+ * \return 0 si toutes les listes sont gales, 1 sinon.
+ */
+int main()
+{
+	std::ifstream fichier("EnglishFrench.txt");
+	Dictionnaire dico(fichier);
+	DictionnaireFige fige(dico);
+
+	std::vector<std::string> mots;
+	DictionnaireFige::Parcours parcours = fige.motsAvecPrefixe("", fige.taille());
+	std::string_view mot;
+	while (parcours.suivant(mot))
+		mots.push_back(std::string(mot));
+
+	std::mt19937 generateur(2014);
+	const unsigned int nbCorrections[] = { 1, 3, 10, 50, UINT_MAX };
+	int nbRequetes = 0;
+	int nbErreurs = 0;
+
+	for (int i = 0; i < 3000; i++)
+	{
+		std::string requete = (i % 10 == 0) ? std::string(4 + generateur() % 8, 'q')
+		                                    : modifier(mots[generateur() % mots.size()], generateur);
+		for (size_t k = 0; k < sizeof(nbCorrections) / sizeof(nbCorrections[0]); k++)
+		{
+			std::vector<std::string> attendu = dico.suggereCorrections(requete, nbCorrections[k]);
+			std::vector<std::string> obtenu = fige.suggereCorrections(requete, nbCorrections[k]);
+			nbRequetes++;
+			if (attendu != obtenu)
+			{
+				if (nbErreurs < 10)
+					std::cout << "\"" << requete << "\" (" << nbCorrections[k] << ") : " << attendu.size()
+					          << " corrections attendues, " << obtenu.size() << " obtenues" << std::endl;
+				nbErreurs++;
+			}
+		}
+	}
+
+	std::cout << nbRequetes << " requetes comparees, " << nbErreurs << " differences" << std::endl;
+	return nbErreurs == 0 ? 0 : 1;
+}
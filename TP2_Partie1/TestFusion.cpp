@@ -0,0 +1,217 @@
+/**
+ * \file TestFusion.cpp
+ * \brief Test de Dictionnaire::fusionner() avec un lot refus
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ * Un lot qui donnerait plus de MAX_TRADUCTIONS traductions  un mot est fusionn par chacun des
+ * trois chemins de fusionner(): arbre vide, petit lot insr mot par mot, fusion en une passe.
+ * Le lot doit tre refus sans rien modifier: aprs l'chec, puis aprs un lot valide, le
+ * dictionnaire et ses corrections doivent tre ceux d'un dictionnaire qui n'a jamais vu le lot.
+ * DictionnairePartage::ajouteMots(), qui passe par fusionner(), ne doit alors rien publier.
+ *
+ *    g++ -std=c++17 -O2 -pthread TestFusion.cpp $(ls *.cpp | grep -v -e Principal -e Banc -e Test)
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Dictionnaire.h"
+#include "DictionnairePartage.h"
+#include "LotDictionnaire.h"
+using namespace TP2P1;
+
+typedef std::map<std::string, std::vector<std::string> > Contenu;
+
+/**
+ * \fn Contenu contenu(const Dictionnaire &dico)
+ * \brief Recopie tous les mots du dictionnaire et leurs traductions, en ordre.
+ */
+Contenu contenu(const Dictionnaire &dico)
+{
+	Contenu resultat;
+	Dictionnaire::Parcours parcours = dico.motsAvecPrefixe("", SIZE_MAX);
+	std::string_view mot;
+	while (parcours.suivant(mot))
+	{
+		VueTraductions traductions = parcours.traductions();
+		std::vector<std::string> &liste = resultat[std::string(mot)];
+		for (size_t i = 0; i < traductions.size(); i++)
+			liste.push_back(std::string(traductions[i]));
+	}
+	return resultat;
+}
+
+/**
+ * \fn void fusionnerTexte(Dictionnaire &dico, const std::string &texte)
+ * \brief Fusionne dans le dictionnaire les lignes  mot<TAB>traduction  du texte.
+ */
+void fusionnerTexte(Dictionnaire &dico, const std::string &texte)
+{
+	LotDictionnaire lot;
+	lot.ajouterTexte(texte);
+	dico.fusionner(lot);
+}
+
+/**
+ * \fn std::string motsAuHasard(size_t nb, std::mt19937 &generateur)
+ * \brief Donne nb lignes de mots au hasard de 5  10 lettres, une traduction chacun.
+ */
+std::string motsAuHasard(size_t nb, std::mt19937 &generateur)
+{
+	std::string texte;
+	for (size_t i = 0; i < nb; i++)
+	{
+		std::string mot(5 + generateur() % 6, 'a');
+		for (size_t j = 0; j < mot.size(); j++)
+			mot[j] = static_cast<char>('a' + generateur() % 26);
+		texte += mot + "\tt" + std::to_string(i) + '\n';
+	}
+	return texte;
+}
+
+/**
+ * \fn std::string motRepete(const std::string &mot, size_t nb)
+ * \brief Donne nb lignes du mme mot, avec des traductions toutes diffrentes.
+ */
+std::string motRepete(const std::string &mot, size_t nb)
+{
+	std::string texte;
+	for (size_t i = 0; i < nb; i++)
+		texte += mot + "\tr" + std::to_string(i) + '\n';
+	return texte;
+}
+
+/**
+ * \fn std::string nouveauxMots(size_t nb)
+ * \brief Donne nb lignes de mots absents des autres textes, placs avant  plein  en ordre.
+ */
+std::string nouveauxMots(size_t nb)
+{
+	std::string texte;
+	for (size_t i = 0; i < nb; i++)
+		texte += "nouveau" + std::to_string(i) + "\tn\n";
+	return texte;
+}
+
+/**
+ * \fn void verifierRefus(const std::string &chemin, const std::string &base, const std::string &refuse)
+ * \brief Fusionne base dans deux dictionnaires, refuse dans le premier seulement, puis un mme lot
+ * valide dans les deux; les deux doivent rester identiques.
+ *
+ * \exception logic_error  la premire diffrence
+ */
+void verifierRefus(const std::string &chemin, const std::string &base, const std::string &refuse)
+{
+	const std::string suite = "nouveau1\tn\nsuite\ts\n";
+	const char * requetes[] = { "nouveau12", "nouveau3x", "nouvea", "plein", "pleinx", "suite", "sute" };
+
+	Dictionnaire dico, reference;
+	dico.fixerTailleCacheCorrections(64);
+	reference.fixerTailleCacheCorrections(64);
+	if (!base.empty())
+	{
+		fusionnerTexte(dico, base);
+		fusionnerTexte(reference, base);
+		// Remplir le cache, qui ne doit pas survivre  une modification partielle
+		for (const char * requete : requetes)
+			dico.suggereCorrections(requete);
+	}
+
+	bool refuseOk = false;
+	try { fusionnerTexte(dico, refuse); }
+	catch (std::length_error &) { refuseOk = true; }
+	if (!refuseOk)
+		throw std::logic_error(chemin + ": le lot n'a pas ete refuse");
+
+	dico.verifierInvariants();
+	if (contenu(dico) != contenu(reference))
+		throw std::logic_error(chemin + ": le lot refuse a modifie le dictionnaire");
+
+	fusionnerTexte(dico, suite);
+	fusionnerTexte(reference, suite);
+	dico.verifierInvariants();
+	if (contenu(dico) != contenu(reference))
+		throw std::logic_error(chemin + ": le dictionnaire differe apres un lot valide");
+	for (const char * requete : requetes)
+		if (dico.suggereCorrections(requete) != reference.suggereCorrections(requete))
+			throw std::logic_error(chemin + ": corrections differentes pour " + requete);
+}
+
+/**
+ * \fn void verifierPartage(size_t max)
+ * \brief Un lot refus par DictionnairePartage::ajouteMots() ne doit tre ni gard ni publi.
+ *
+ * \exception logic_error  la premire diffrence
+ */
+void verifierPartage(size_t max)
+{
+	DictionnairePartage partage;
+	std::vector<std::pair<std::string, std::string> > paires;
+	paires.push_back(std::make_pair("plein", "r"));
+	paires.push_back(std::make_pair("autre", "a"));
+	paires.push_back(std::make_pair("plein", "s"));
+	partage.ajouteMots(paires);
+	if (partage.traduit("plein") != std::vector<std::string>({ "r", "s" }))
+		throw std::logic_error("partage: les traductions ne sont pas dans l'ordre des paires");
+
+	uint64_t versions = partage.nbVersions();
+	paires.assign(1, std::make_pair("nouveau", "n"));
+	for (size_t i = 0; i < max; i++)
+		paires.push_back(std::make_pair("plein", "t" + std::to_string(i)));
+	bool refuseOk = false;
+	try { partage.ajouteMots(paires); }
+	catch (std::length_error &) { refuseOk = true; }
+	if (!refuseOk || partage.nbVersions() != versions)
+		throw std::logic_error("partage: le lot n'a pas ete refuse sans publication");
+
+	partage.ajouteMots(std::vector<std::pair<std::string, std::string> >(1, std::make_pair("suite", "s")));
+	if (partage.appartient("nouveau") || partage.traduit("plein").size() != 2 || !partage.appartient("suite"))
+		throw std::logic_error("partage: la version suivante montre le lot refuse");
+}
+
+/**
+ * \fn int main()
+ * \brief Vrifie le refus d'un lot trop grand sur chacun des trois chemins de fusionner().
+ *
+ * \return 0 si chaque lot refus a laiss le dictionnaire intact, 1 sinon.
+ */
+int main()
+{
+	std::mt19937 generateur(2014);
+	const size_t MAX = UINT16_MAX;	// Dictionnaire::MAX_TRADUCTIONS, priv
+	int nbChemins = 0;
+
+	try
+	{
+		// Arbre vide: l'arbre serait construit d'un coup
+		verifierRefus("arbre vide", "", nouveauxMots(100) + motRepete("plein", MAX + 1));
+		nbChemins++;
+
+		// Petit lot (moins de cpt / RAPPORT_FUSION paires): insertions mot par mot
+		std::string base = motsAuHasard(20000, generateur) + motRepete("plein", MAX - 500);
+		verifierRefus("petit lot", base, nouveauxMots(100) + motRepete("plein", 600));
+		nbChemins++;
+
+		// Grand lot: fusion en une passe avec les mots en ordre de l'arbre
+		base = motsAuHasard(2000, generateur) + motRepete("plein", MAX - 500);
+		verifierRefus("fusion en une passe", base, nouveauxMots(5000) + motRepete("plein", 600));
+		nbChemins++;
+
+		verifierPartage(MAX);
+	}
+	catch (std::exception &e)
+	{
+		std::cout << "Echec apres " << nbChemins << " chemins : " << e.what() << std::endl;
+		return 1;
+	}
+
+	std::cout << nbChemins << " chemins de fusion, lots refuses sans modification, aucune erreur" << std::endl;
+	return 0;
+}
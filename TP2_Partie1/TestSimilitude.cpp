@@ -0,0 +1,99 @@
+/**
+ * \file TestSimilitude.cpp
+ * \brief Test de non-rgression de Dictionnaire::similitude()
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ * Compare le calcul en O(L) avec l'algorithme d'origine (sous-mots et find) sur des paires
+ * de mots alatoires: les scores doivent tre exactement les mmes.
+ *
+ *    g++ -std=c++17 -O2 -pthread TestSimilitude.cpp $(ls *.cpp | grep -v -e Principal -e Banc -e Test)
+ */
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "Dictionnaire.h"
+using namespace TP2P1;
+
+/**
+ * \fn double similitudeOrigine(const std::string& mot1, const std::string& mot2)
+ * \brief L'algorithme d'origine de Dictionnaire::similitude(), gard comme rfrence.
+ */
+static double similitudeOrigine(const std::string& mot1, const std::string& mot2)
+{
+	double similarity = 0.;
+	std::string bigger = mot1.size() > mot2.size() ? mot1 : mot2;
+	std::string smaller = mot1.size() > mot2.size() ? mot2 : mot1;
+
+	//On parcoure chacune des lettre du plus petit mot
+	for (size_t j = 0; j < smaller.size(); j++)
+	{
+		//On parcoure le reste du mot  partir de la lettre actuelle
+		for (size_t i = 0; i < smaller.size() - j; i++)
+		{
+			//on teste si mot partiel est trouvable dans le plus grand mot.
+			if (bigger.find(smaller.substr(j, i + 1)) != std::string::npos)
+				similarity++;
+		}
+	}
+
+	return similarity / (smaller.size() * smaller.size());
+}
+
+/**
+ * \fn std::string motAleatoire(std::mt19937 &generateur, size_t longueurMax, char derniereLettre)
+ * \brief Un mot d'au plus longueurMax lettres, entre 'a' et derniereLettre.
+ */
+static std::string motAleatoire(std::mt19937 &generateur, size_t longueurMax, char derniereLettre)
+{
+	std::string mot(generateur() % (longueurMax + 1), 'a');
+	for (size_t i = 0; i < mot.size(); i++)
+		mot[i] = static_cast<char>('a' + generateur() % (derniereLettre - 'a' + 1));
+	return mot;
+}
+
+/**
+ * \fn int main()
+ * \brief Compare les deux calculs et affiche les paires qui diffrent.
+ *
+ * \return 0 si tous les scores sont gaux, 1 sinon.
+ */
+int main()
+{
+	Dictionnaire dico;
+	std::mt19937 generateur(2014);
+	const char alphabets[] = { 'b', 'd', 'z' };	// Petits alphabets: beaucoup de sous-mots communs
+	int nbPaires = 0;
+	int nbErreurs = 0;
+
+	for (int i = 0; i < 300000; i++)
+	{
+		char derniereLettre = alphabets[i % 3];
+		size_t longueurMax = (i % 100 == 0) ? 200 : 13;	// Quelques mots au-del d'une tranche de 64 lettres
+		std::string mot1 = motAleatoire(generateur, longueurMax, derniereLettre);
+		std::string mot2 = motAleatoire(generateur, 13, derniereLettre);
+
+		double attendu = similitudeOrigine(mot1, mot2);
+		double obtenu = dico.similitude(mot1, mot2);
+		double obtenuVue = dico.similitude(std::string_view(mot1), std::string_view(mot2));
+		nbPaires++;
+
+		// Un mot vide donne 0/0 dans les deux calculs
+		bool egal = (std::isnan(attendu) && std::isnan(obtenu) && std::isnan(obtenuVue))
+		            || (attendu == obtenu && attendu == obtenuVue);
+		if (!egal)
+		{
+			if (nbErreurs < 10)
+				std::cout << "\"" << mot1 << "\" / \"" << mot2 << "\" : " << attendu << " attendu, "
+				          << obtenu << " et " << obtenuVue << " obtenus" << std::endl;
+			nbErreurs++;
+		}
+	}
+
+	std::cout << nbPaires << " paires comparees, " << nbErreurs << " differences" << std::endl;
+	return nbErreurs == 0 ? 0 : 1;
+}
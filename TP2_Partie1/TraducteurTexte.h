@@ -0,0 +1,234 @@
+/**
+ * \file TraducteurTexte.h
+ * \brief Ce fichier contient la traduction mot  mot d'une phrase ou d'un texte, sans interaction.
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+
+
+#ifndef TRADUCTEUR_TEXTE_H_
+#define TRADUCTEUR_TEXTE_H_
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "VueTraductions.h"
+
+namespace TP2P1
+{
+/**
+* \class TraducteurTexte
+*
+* \brief Traduit un texte mot  mot avec un Dictionnaire ou un DictionnaireFige
+*
+*  Le texte est dcoup en une seule passe, sans copie: les mots sont des string_view dans le
+*  texte. Chaque mot est remplac par sa premire traduction, ou laiss tel quel s'il n'est pas
+*  dans le dictionnaire; les sparateurs sont recopis. Un mot n'est cherch qu'une fois: le
+*  rsultat est gard dans un cache, vid au dbut de chaque phrase et, pour un texte, ds qu'il
+*  atteint TAILLE_MAX_CACHE mots.
+*
+*  Le dictionnaire ne doit pas tre modifi pendant la traduction, ni le texte dtruit.
+*/
+template <typename D>
+class TraducteurTexte
+{
+public:
+
+	/*
+	*\brief		Constructeur
+	*
+	*/
+	explicit TraducteurTexte(const D &dico);
+
+	/*
+	*\brief		Traduire une phrase
+	*
+	*\post		On retourne la phrase traduite; le cache ne sert que pour cette phrase
+	*
+	*/
+	std::string traduirePhrase(std::string_view phrase);
+
+	/*
+	*\brief		Traduire un texte entier et l'crire au fur et  mesure
+	*			Le texte traduit est crit par morceaux d'environ TAILLE_TAMPON caractres
+	*
+	*\post		sortie contient le texte traduit
+	*
+	*/
+	void traduireTexte(std::string_view texte, std::ostream &sortie);
+
+	/*
+	*\brief		Extraire le prochain mot d'un texte
+	*
+	*\post		On retourne false s'il ne reste aucun mot. Sinon, mot est le premier mot de reste
+	*\post		et reste commence juste aprs lui
+	*
+	*/
+	static bool motSuivant(std::string_view &reste, std::string_view &mot);
+
+private:
+
+   const D &dico;		// Le dictionnaire utilis
+
+   std::unordered_map<std::string_view, std::string_view> cache;	// La traduction de chaque mot dj vu
+
+   static const size_t TAILLE_MAX_CACHE = 65536;	// Le nombre de mots au-del duquel le cache est vid
+
+   static const size_t TAILLE_TAMPON = 65536;	// La taille des morceaux crits par traduireTexte()
+
+   /*
+	*\brief		Vrai si le caractre spare deux mots
+	*/
+   static bool _estSeparateur(char c);
+
+   /*
+	*\brief		Donne la traduction d'un mot, en le cherchant dans le dictionnaire seulement la premire fois
+	*/
+   std::string_view _traduireMot(std::string_view mot);
+
+   /*
+	*\brief		Ajouter la traduction du texte au tampon; si sortie n'est pas nulle, le tampon
+	*			y est vid ds qu'il atteint TAILLE_TAMPON
+	*/
+   void _traduire(std::string_view texte, std::string &tampon, std::ostream *sortie);
+};
+
+	/**
+	 * \fn TraducteurTexte<D>::TraducteurTexte(const D &dico)
+	 * \param[in] dico : Le dictionnaire utilis
+	 */
+	template <typename D>
+	TraducteurTexte<D>::TraducteurTexte(const D &dico) : dico(dico)
+	{
+	}
+
+	/**
+	 * \fn std::string TraducteurTexte<D>::traduirePhrase(std::string_view phrase)
+	 * \param[in] phrase : La phrase  traduire
+	 */
+	template <typename D>
+	std::string TraducteurTexte<D>::traduirePhrase(std::string_view phrase)
+	{
+		cache.clear();
+		std::string traduction;
+		traduction.reserve(phrase.size());
+		_traduire(phrase, traduction, 0);
+		return traduction;
+	}
+
+	/**
+	 * \fn void TraducteurTexte<D>::traduireTexte(std::string_view texte, std::ostream &sortie)
+	 * \param[in] texte : Le texte  traduire
+	 * \param[out] sortie : Le flot o crire le texte traduit
+	 */
+	template <typename D>
+	void TraducteurTexte<D>::traduireTexte(std::string_view texte, std::ostream &sortie)
+	{
+		std::string tampon;
+		tampon.reserve(2 * TAILLE_TAMPON);
+		_traduire(texte, tampon, &sortie);
+		sortie.write(tampon.data(), tampon.size());
+	}
+
+	/**
+	 * \fn bool TraducteurTexte<D>::motSuivant(std::string_view &reste, std::string_view &mot)
+	 * \param[in,out] reste : Le texte qui reste  dcouper
+	 * \param[out] mot : Le mot trouv
+	 */
+	template <typename D>
+	bool TraducteurTexte<D>::motSuivant(std::string_view &reste, std::string_view &mot)
+	{
+		size_t debut = 0;
+		while (debut < reste.size() && _estSeparateur(reste[debut]))
+			debut++;
+		if (debut == reste.size())
+		{
+			reste = std::string_view();
+			return false;
+		}
+
+		size_t fin = debut;
+		while (fin < reste.size() && !_estSeparateur(reste[fin]))
+			fin++;
+		mot = reste.substr(debut, fin - debut);
+		reste = reste.substr(fin);
+		return true;
+	}
+
+	/**
+	 * \fn bool TraducteurTexte<D>::_estSeparateur(char c)
+	 * \param[in] c : Le caractre
+	 *
+	 * Les blancs et la ponctuation sparent les mots; l'apostrophe et le trait d'union n'en
+	 * sparent pas.
+	 */
+	template <typename D>
+	bool TraducteurTexte<D>::_estSeparateur(char c)
+	{
+		switch (c)
+		{
+		case ' ': case '\t': case '\n': case '\r': case '\f': case '\v':
+		case '.': case ',': case ';': case ':': case '!': case '?':
+		case '"': case '(': case ')': case '[': case ']': case '{': case '}':
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	/**
+	 * \fn std::string_view TraducteurTexte<D>::_traduireMot(std::string_view mot)
+	 * \param[in] mot : Le mot  traduire
+	 */
+	template <typename D>
+	std::string_view TraducteurTexte<D>::_traduireMot(std::string_view mot)
+	{
+		typename std::unordered_map<std::string_view, std::string_view>::const_iterator trouve = cache.find(mot);
+		if (trouve != cache.end())
+			return trouve->second;
+
+		if (cache.size() >= TAILLE_MAX_CACHE)
+			cache.clear();
+
+		//Une seule recherche dans le dictionnaire: la vue dit aussi si le mot y est
+		VueTraductions traductions = dico.vueTraductions(mot);
+		std::string_view traduction = traductions.empty() ? mot : traductions[0];
+		cache.emplace(mot, traduction);
+		return traduction;
+	}
+
+	/**
+	 * \fn void TraducteurTexte<D>::_traduire(std::string_view texte, std::string &tampon, std::ostream *sortie)
+	 * \param[in] texte : Le texte  traduire
+	 * \param[in,out] tampon : Le texte traduit, pas encore crit
+	 * \param[out] sortie : Le flot o vider le tampon, ou 0
+	 */
+	template <typename D>
+	void TraducteurTexte<D>::_traduire(std::string_view texte, std::string &tampon, std::ostream *sortie)
+	{
+		std::string_view reste = texte;
+		std::string_view mot;
+		const char * curseur = texte.data();	// La fin de ce qui est dj traduit
+		while (motSuivant(reste, mot))
+		{
+			//Les sparateurs entre le mot prcdent et celui-ci sont recopis tels quels
+			tampon.append(curseur, mot.data() - curseur);
+			tampon.append(_traduireMot(mot));
+			curseur = mot.data() + mot.size();
+
+			if (sortie != 0 && tampon.size() >= TAILLE_TAMPON)
+			{
+				sortie->write(tampon.data(), tampon.size());
+				tampon.clear();
+			}
+		}
+		tampon.append(curseur, texte.data() + texte.size() - curseur);
+	}
+
+}
+
+#endif /* TRADUCTEUR_TEXTE_H_ */
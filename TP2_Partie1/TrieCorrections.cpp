@@ -0,0 +1,255 @@
+/**
+ * \file TrieCorrections.cpp
+ * \brief Ce fichier contient une implantation des mthodes de la classe TrieCorrections
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+#include "TrieCorrections.h"
+namespace TP2P1
+{
+
+	/**
+	 * \fn TrieCorrections::TrieCorrections()
+	 */
+	TrieCorrections::TrieCorrections()
+	{
+		vider();
+	}
+
+	/**
+	 * \fn void TrieCorrections::vider()
+	 */
+	void TrieCorrections::vider()
+	{
+		noeuds.clear();
+		etiquettes.clear();
+		noeuds.push_back(NoeudTrie(0, 0)); //La racine
+		profondeurMax = 0;
+	}
+
+	/**
+	 * \fn void TrieCorrections::ajouter(std::string_view mot)
+	 * \param[in] mot : Mot  ajouter
+	 */
+	void TrieCorrections::ajouter(std::string_view mot)
+	{
+		uint32_t courant = 0;
+		size_t i = 0;
+		while (i < mot.size())
+		{
+			unsigned char lettre = static_cast<unsigned char>(mot[i]);
+
+			//On cherche la place de la lettre parmi les premires lettres des enfants, gards en ordre
+			uint32_t precedent = 0;
+			uint32_t enfant = noeuds[courant].premierEnfant;
+			while (enfant != 0 && static_cast<unsigned char>(etiquettes[noeuds[enfant].debutEtiquette]) < lettre)
+			{
+				precedent = enfant;
+				enfant = noeuds[enfant].frereSuivant;
+			}
+
+			if (enfant == 0 || static_cast<unsigned char>(etiquettes[noeuds[enfant].debutEtiquette]) != lettre)
+			{
+				//Aucune branche ne commence par cette lettre: une seule feuille prend la suite du mot
+				size_t longueur = mot.size() - i < LONGUEUR_MAX ? mot.size() - i : LONGUEUR_MAX;
+				uint32_t nouveau = static_cast<uint32_t>(noeuds.size());
+				noeuds.push_back(NoeudTrie(static_cast<uint32_t>(etiquettes.size()), static_cast<uint16_t>(longueur)));
+				etiquettes.insert(etiquettes.end(), mot.data() + i, mot.data() + i + longueur);
+				noeuds[nouveau].frereSuivant = enfant;
+				if (precedent == 0)
+					noeuds[courant].premierEnfant = nouveau;
+				else
+					noeuds[precedent].frereSuivant = nouveau;
+				courant = nouveau;
+				i += longueur;
+				continue;
+			}
+
+			//On suit la branche tant que ses lettres sont celles du mot, et on la coupe l o elles diffrent
+			const NoeudTrie &branche = noeuds[enfant];
+			size_t communes = 1;
+			while (communes < branche.longueur && i + communes < mot.size()
+			       && etiquettes[branche.debutEtiquette + communes] == mot[i + communes])
+				communes++;
+			if (communes < branche.longueur)
+				_couper(enfant, static_cast<uint16_t>(communes));
+
+			courant = enfant;
+			i += communes;
+		}
+
+		if (noeuds[courant].finDeMot) //Le mot y est dj
+			return;
+		noeuds[courant].finDeMot = true;
+
+		//On compte le mot dans chaque noeud du chemin
+		courant = 0;
+		noeuds[0].nbMots++;
+		for (size_t j = 0; j < mot.size(); j += noeuds[courant].longueur)
+		{
+			courant = _enfant(courant, mot[j]);
+			noeuds[courant].nbMots++;
+		}
+
+		if (mot.size() > profondeurMax)
+			profondeurMax = mot.size();
+	}
+
+	/**
+	 * \fn void TrieCorrections::retirer(const std::string &mot)
+	 * \param[in] mot : Mot  retirer
+	 *
+	 * Les noeuds restent en place; un sous-arbre sans mot est simplement saut  la recherche.
+	 */
+	void TrieCorrections::retirer(const std::string &mot)
+	{
+		uint32_t courant = 0;
+		for (size_t i = 0; i < mot.size(); i += noeuds[courant].longueur)
+		{
+			courant = _enfant(courant, mot[i]);
+			if (courant == 0 || mot.compare(i, noeuds[courant].longueur, &etiquettes[noeuds[courant].debutEtiquette],
+			                                noeuds[courant].longueur) != 0) //Le mot n'y est pas
+				return;
+		}
+
+		if (!noeuds[courant].finDeMot)
+			return;
+		noeuds[courant].finDeMot = false;
+
+		courant = 0;
+		noeuds[0].nbMots--;
+		for (size_t i = 0; i < mot.size(); i += noeuds[courant].longueur)
+		{
+			courant = _enfant(courant, mot[i]);
+			noeuds[courant].nbMots--;
+		}
+	}
+
+	/**
+	 * \fn void TrieCorrections::motsProches(const std::string &mot, unsigned int distanceMax, std::vector<std::pair<unsigned int, std::string> > &resultats) const
+	 * \param[in] mot : Mot  corriger
+	 * \param[in] distanceMax : Distance d'dition maximale
+	 * \param[out] resultats : Les paires (distance, mot) trouves
+	 */
+	void TrieCorrections::motsProches(const std::string &mot, unsigned int distanceMax,
+	                                  std::vector<std::pair<unsigned int, std::string> > &resultats) const
+	{
+		resultats.clear();
+		if (noeuds[0].nbMots == 0)
+			return;
+
+		//Une ligne de la matrice de Levenshtein par lettre de profondeur
+		std::vector<unsigned int> lignes((profondeurMax + 1) * (mot.size() + 1));
+		for (size_t i = 0; i <= mot.size(); i++)
+			lignes[i] = static_cast<unsigned int>(i);
+
+		if (noeuds[0].finDeMot && mot.size() <= distanceMax) //Le mot vide
+			resultats.push_back(std::make_pair(static_cast<unsigned int>(mot.size()), std::string()));
+
+		std::string prefixe;
+		for (uint32_t enfant = noeuds[0].premierEnfant; enfant != 0; enfant = noeuds[enfant].frereSuivant)
+		{
+			if (noeuds[enfant].nbMots != 0)
+				_auxMotsProches(enfant, 0, mot, distanceMax, lignes, prefixe, resultats);
+		}
+	}
+
+	/**
+	 * \fn uint32_t TrieCorrections::_enfant(uint32_t noeud, char lettre) const
+	 * \param[in] noeud : Indice du parent
+	 * \param[in] lettre : Premire lettre de la branche cherche
+	 */
+	uint32_t TrieCorrections::_enfant(uint32_t noeud, char lettre) const
+	{
+		uint32_t enfant = noeuds[noeud].premierEnfant;
+		while (enfant != 0 && etiquettes[noeuds[enfant].debutEtiquette] != lettre)
+			enfant = noeuds[enfant].frereSuivant;
+		return enfant;
+	}
+
+	/**
+	 * \fn void TrieCorrections::_couper(uint32_t noeud, uint16_t longueur)
+	 * \param[in] noeud : Noeud  couper
+	 * \param[in] longueur : Nombre de lettres qu'il garde
+	 */
+	void TrieCorrections::_couper(uint32_t noeud, uint16_t longueur)
+	{
+		//Les lettres restent en place dans la rserve: la suite commence simplement plus loin
+		NoeudTrie suite = noeuds[noeud];
+		suite.debutEtiquette += longueur;
+		suite.longueur -= longueur;
+		suite.frereSuivant = 0;
+
+		uint32_t nouveau = static_cast<uint32_t>(noeuds.size());
+		noeuds.push_back(suite);
+		noeuds[noeud].longueur = longueur;
+		noeuds[noeud].premierEnfant = nouveau;
+		noeuds[noeud].finDeMot = false;
+	}
+
+	/**
+	 * \fn void TrieCorrections::_auxMotsProches(uint32_t noeud, size_t profondeur, const std::string &mot, unsigned int distanceMax, std::vector<unsigned int> &lignes, std::string &prefixe, std::vector<std::pair<unsigned int, std::string> > &resultats) const
+	 * \param[in] noeud : Noeud visit
+	 * \param[in] profondeur : La profondeur de son parent (longueur du prfixe avant ses lettres)
+	 * \param[in] mot : Mot  corriger
+	 * \param[in] distanceMax : Distance d'dition maximale
+	 * \param[in,out] lignes : Les lignes de Levenshtein, une par lettre de profondeur
+	 * \param[in,out] prefixe : Le prfixe qui mne au parent
+	 * \param[out] resultats : Les paires (distance, mot) trouves
+	 */
+	void TrieCorrections::_auxMotsProches(uint32_t noeud, size_t profondeur, const std::string &mot, unsigned int distanceMax,
+	                                      std::vector<unsigned int> &lignes, std::string &prefixe,
+	                                      std::vector<std::pair<unsigned int, std::string> > &resultats) const
+	{
+		const NoeudTrie &n = noeuds[noeud];
+		size_t largeur = mot.size() + 1;
+		size_t tailleAvant = prefixe.size();
+		unsigned int *ligne = 0;
+
+		//Une ligne par lettre du noeud; ligne[i] : distance entre le prfixe et les i premires lettres du mot
+		for (uint16_t k = 0; k < n.longueur; k++)
+		{
+			char lettre = etiquettes[n.debutEtiquette + k];
+			profondeur++;
+			const unsigned int *precedente = &lignes[(profondeur - 1) * largeur];
+			ligne = &lignes[profondeur * largeur];
+
+			ligne[0] = static_cast<unsigned int>(profondeur);
+			unsigned int minimum = ligne[0];
+			for (size_t i = 1; i < largeur; i++)
+			{
+				unsigned int remplacement = precedente[i - 1] + (mot[i - 1] == lettre ? 0 : 1);
+				unsigned int insertion = ligne[i - 1] + 1;
+				unsigned int suppression = precedente[i] + 1;
+
+				ligne[i] = remplacement < insertion ? remplacement : insertion;
+				if (suppression < ligne[i])
+					ligne[i] = suppression;
+				if (ligne[i] < minimum)
+					minimum = ligne[i];
+			}
+			prefixe.push_back(lettre);
+
+			//Si toute la ligne dpasse la borne, aucun mot de ce sous-arbre ne peut s'en approcher
+			if (minimum > distanceMax)
+			{
+				prefixe.resize(tailleAvant);
+				return;
+			}
+		}
+
+		if (n.finDeMot && ligne[largeur - 1] <= distanceMax)
+			resultats.push_back(std::make_pair(ligne[largeur - 1], prefixe));
+
+		for (uint32_t enfant = n.premierEnfant; enfant != 0; enfant = noeuds[enfant].frereSuivant)
+		{
+			if (noeuds[enfant].nbMots != 0)
+				_auxMotsProches(enfant, profondeur, mot, distanceMax, lignes, prefixe, resultats);
+		}
+
+		prefixe.resize(tailleAvant);
+	}
+
+}//Fin du namespace
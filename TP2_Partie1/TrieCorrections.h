@@ -0,0 +1,145 @@
+/**
+ * \file TrieCorrections.h
+ * \brief Ce fichier contient l'interface d'un index (trie) des mots pour la correction.
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+
+
+#ifndef TRIE_CORRECTIONS_H_
+#define TRIE_CORRECTIONS_H_
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+namespace TP2P1
+{
+/**
+* \class TrieCorrections
+*
+* \brief Arbre de prfixes (trie) des mots d'un dictionnaire
+*
+*  Le trie sert  trouver les mots  une distance d'dition (Levenshtein) borne d'un mot mal
+*  crit. La recherche descend le trie en calculant une ligne de la matrice de Levenshtein par
+*  niveau; ds que toute la ligne dpasse la distance maximale, le sous-arbre est abandonn.
+*  Les mots loigns ne sont donc jamais visits.
+*
+*  Les noeuds sont rangs dans un vector (premier enfant, frre suivant) et les enfants sont
+*  gards en ordre alphabtique, ce qui rend l'ordre des rsultats dterministe.
+*
+*  Les chemins sans embranchement sont compresss: un noeud porte toute une suite de lettres,
+*  range dans une rserve commune. Un mot ajout cre au plus deux noeuds (une coupure et une
+*  feuille), au lieu d'un noeud par lettre qui n'est pas partage.
+*/
+class TrieCorrections
+{
+public:
+
+	/*
+	*\brief		Constructeur
+	*
+	*\post		Un trie vide a t initialis
+	*
+	*/
+	TrieCorrections();
+
+	/*
+	*\brief		Ajouter un mot au trie
+	*
+	*\post		Le mot fait partie du trie (l'ajouter deux fois ne change rien)
+	*
+	*\exception	bad_alloc s'il n'y a pas assez de mmoire
+	*
+	*/
+	void ajouter(std::string_view mot);
+
+	/*
+	*\brief		Retirer un mot du trie
+	*
+	*\post		Le mot ne fait plus partie du trie. S'il n'y tait pas, on ne fait rien.
+	*
+	*/
+	void retirer(const std::string &mot);
+
+	/*
+	*\brief		Vider le trie
+	*
+	*\post		Le trie est vide
+	*
+	*/
+	void vider();
+
+	/*
+	*\brief		Trouver les mots  une distance d'dition d'au plus distanceMax du mot donn
+	*
+	*\post		resultats contient les paires (distance, mot), en ordre alphabtique des mots
+	*\post		Le trie est inchang
+	*
+	*/
+	void motsProches(const std::string &mot, unsigned int distanceMax,
+	                 std::vector<std::pair<unsigned int, std::string> > &resultats) const;
+
+private:
+
+	class NoeudTrie
+	{
+	public:
+
+		uint32_t premierEnfant;		// L'indice du premier enfant (0 s'il n'y en a pas)
+
+		uint32_t frereSuivant;		// L'indice du frre suivant, en ordre alphabtique de la premire lettre (0 s'il n'y en a pas)
+
+		uint32_t nbMots;			// Le nombre de mots dans le sous-arbre, pour ne pas visiter les branches vides
+
+		uint32_t debutEtiquette;	// La position dans etiquettes des lettres qui mnent  ce noeud
+
+		uint16_t longueur;			// Le nombre de ces lettres (au moins 1, sauf pour la racine)
+
+		bool finDeMot;				// Vrai si le chemin jusqu'ici forme un mot
+
+		NoeudTrie(uint32_t debut, uint16_t n) : premierEnfant(0), frereSuivant(0), nbMots(0), debutEtiquette(debut), longueur(n), finDeMot(false) {}
+	};
+
+   std::vector<NoeudTrie> noeuds;	// Les noeuds du trie, noeuds[0] est la racine
+
+   std::vector<char> etiquettes;	// Les lettres de tous les noeuds, bout  bout
+
+   size_t profondeurMax;			// La longueur du plus long mot ajout
+
+   static const uint16_t LONGUEUR_MAX = UINT16_MAX;	// Au-del, les lettres d'une branche sont rparties sur plusieurs noeuds
+
+   /*
+	*\brief		Trouver l'enfant d'un noeud pour une lettre
+	*
+	*\post		On retourne l'indice de l'enfant, ou 0 s'il n'existe pas
+	*
+	*/
+   uint32_t _enfant(uint32_t noeud, char lettre) const;
+
+   /*
+	*\brief		Couper un noeud aprs ses longueur premires lettres
+	*
+	*\post		Le noeud garde ces lettres; un nouvel enfant unique prend le reste, ses enfants et ses mots
+	*
+	*/
+   void _couper(uint32_t noeud, uint16_t longueur);
+
+   /*
+	*\brief		Descendre rcursivement le trie en calculant les lignes de Levenshtein
+	*
+	*\post		Le trie est inchang
+	*
+	*/
+   void _auxMotsProches(uint32_t noeud, size_t profondeur, const std::string &mot, unsigned int distanceMax,
+                        std::vector<unsigned int> &lignes, std::string &prefixe,
+                        std::vector<std::pair<unsigned int, std::string> > &resultats) const;
+};
+
+}
+
+#endif /* TRIE_CORRECTIONS_H_ */
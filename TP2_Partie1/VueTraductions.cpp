@@ -0,0 +1,88 @@
+/**
+ * \file VueTraductions.cpp
+ * \brief Ce fichier contient une implantation des mthodes de la classe VueTraductions
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+#include "VueTraductions.h"
+namespace TP2P1
+{
+
+	/**
+	 * \fn VueTraductions::VueTraductions()
+	 */
+	VueTraductions::VueTraductions() : ids(0), table(0), reserve(0), debuts(0), nb(0)
+	{
+	}
+
+	/**
+	 * \fn VueTraductions::VueTraductions(const uint32_t * ids, const TableChaines * table, size_t nb)
+	 * \param[in] ids : L'identifiant de chaque traduction
+	 * \param[in] table : La table qui donne les chanes des identifiants
+	 * \param[in] nb : Le nombre de traductions
+	 */
+	VueTraductions::VueTraductions(const uint32_t * ids, const TableChaines * table, size_t nb)
+		: ids(ids), table(table), reserve(0), debuts(0), nb(nb)
+	{
+	}
+
+	/**
+	 * \fn VueTraductions::VueTraductions(const char * reserve, const uint32_t * debuts, size_t nb)
+	 * \param[in] reserve : Les traductions, bout  bout
+	 * \param[in] debuts : La position de chaque traduction, suivie de la fin de la dernire
+	 * \param[in] nb : Le nombre de traductions
+	 */
+	VueTraductions::VueTraductions(const char * reserve, const uint32_t * debuts, size_t nb)
+		: ids(0), table(0), reserve(reserve), debuts(debuts), nb(nb)
+	{
+	}
+
+	/**
+	 * \fn bool VueTraductions::trouve() const
+	 */
+	bool VueTraductions::trouve() const
+	{
+		return table != 0 || reserve != 0;
+	}
+
+	/**
+	 * \fn size_t VueTraductions::size() const
+	 */
+	size_t VueTraductions::size() const
+	{
+		return nb;
+	}
+
+	/**
+	 * \fn bool VueTraductions::empty() const
+	 */
+	bool VueTraductions::empty() const
+	{
+		return nb == 0;
+	}
+
+	/**
+	 * \fn std::string_view VueTraductions::operator[](size_t i) const
+	 * \param[in] i : L'indice de la traduction
+	 */
+	std::string_view VueTraductions::operator[](size_t i) const
+	{
+		if (table != 0)
+			return table->chaine(ids[i]);
+		return std::string_view(reserve + debuts[i], debuts[i + 1] - debuts[i]);
+	}
+
+	/**
+	 * \fn std::string_view VueTraductions::at(size_t i) const
+	 * \param[in] i : L'indice de la traduction
+	 */
+	std::string_view VueTraductions::at(size_t i) const
+	{
+		if (i >= nb)
+			throw std::out_of_range("VueTraductions: indice de traduction invalide\n");
+		return (*this)[i];
+	}
+
+}
@@ -0,0 +1,110 @@
+/**
+ * \file VueTraductions.h
+ * \brief Ce fichier contient l'interface d'une vue, sans copie, sur les traductions d'un mot.
+ * \author tudiant 1, tudiant 2
+ * \version 0.1
+ * \date juillet 2014
+ *
+ */
+
+
+#ifndef VUE_TRADUCTIONS_H_
+#define VUE_TRADUCTIONS_H_
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+#include "TableChaines.h"
+
+namespace TP2P1
+{
+/**
+* \class VueTraductions
+*
+* \brief Donne accs aux traductions d'un mot sans les copier
+*
+*  La vue ne possde rien: elle pointe soit sur les identifiants des traductions d'un noeud du Dictionnaire,
+*  soit sur les positions des traductions dans la rserve d'un DictionnaireFige. Elle reste
+*  valide tant que le dictionnaire n'est pas modifi. Une vue construite par dfaut indique
+*  que le mot est introuvable.
+*/
+class VueTraductions
+{
+public:
+
+	/*
+	*\brief		Constructeur d'une vue sur un mot introuvable
+	*
+	*\post		La vue est vide et trouve() retourne false
+	*
+	*/
+	VueTraductions();
+
+	/*
+	*\brief		Constructeur d'une vue sur des traductions dsignes par leurs identifiants dans une table
+	*
+	*\post		La traduction i est table->chaine(ids[i])
+	*
+	*/
+	VueTraductions(const uint32_t * ids, const TableChaines * table, size_t nb);
+
+	/*
+	*\brief		Constructeur d'une vue sur des traductions mises bout  bout dans une rserve
+	*
+	*\post		La traduction i va de reserve + debuts[i]  reserve + debuts[i + 1]
+	*
+	*/
+	VueTraductions(const char * reserve, const uint32_t * debuts, size_t nb);
+
+	/*
+	*\brief		Vrai si le mot cherch appartient au dictionnaire
+	*
+	*/
+	bool trouve() const;
+
+	/*
+	*\brief		Donne le nombre de traductions
+	*
+	*/
+	size_t size() const;
+
+	/*
+	*\brief		Vrai s'il n'y a aucune traduction
+	*
+	*/
+	bool empty() const;
+
+	/*
+	*\brief		Donne la traduction i, sans vrifier l'indice
+	*
+	*\pre		i < size()
+	*
+	*/
+	std::string_view operator[](size_t i) const;
+
+	/*
+	*\brief		Donne la traduction i
+	*
+	*\exception	out_of_range si i >= size()
+	*
+	*/
+	std::string_view at(size_t i) const;
+
+private:
+
+   const uint32_t * ids;			// Les identifiants des traductions d'un noeud
+
+   const TableChaines * table;		// La table des identifiants, ou 0
+
+   const char * reserve;			// La rserve d'un dictionnaire fig, ou 0
+
+   const uint32_t * debuts;		// [nb+1] Les positions des traductions dans la rserve
+
+   size_t nb;					// Le nombre de traductions
+};
+
+}
+
+#endif /* VUE_TRADUCTIONS_H_ */
@@ -0,0 +1,330 @@
+/**
+ * \file BancBottin.cpp
+ * \brief Banc d'essai: temps d'une recherche dans les tables de dispersion selon leur remplissage
+ * \author Mathieu L'cuyer, ric Guillemette
+ * \version 0.1
+ * \date juillet 2014
+ *
+ * Le Bottin ne dpasse jamais TAUX_MAX (50%): pour mesurer  75% et 90%, les deux dispositions
+ * d'une table sont reproduites ici, avec le mme hachage (37 * h + c) et le mme sondage
+ * quadratique. L'ancienne garde dans chaque case la cl et son tat, et compare la cl  chaque
+ * sondage; la nouvelle garde  part un octet de contrle par case (VIDE, SUPPRIMEE ou 7 bits du
+ * hachage) et ne compare la cl que si cet octet correspond. Les requtes sont moiti des cls
+ * prsentes, moiti des cls absentes. Enfin, la classe Bottin elle-mme est mesure avec
+ * contient(), au remplissage qu'elle atteint seule.
+ *
+ *    g++ -std=c++17 -O2 -I. BancBottin.cpp Bottin.cpp
+ *
+ * Le nombre de cases des tables peut tre donn en argument (2 000 003 par dfaut, plus que le cache).
+ *
+ * Avec l'argument  latence  (suivi du nombre d'employs, 1 000 000 par dfaut), chaque appel 
+ * ajouter() est chronomtr seul,  partir d'un Bottin() vide: pour chaque tranche d'appels (jusqu'
+ * 1 000, 10 000, ...), la moyenne, le 99e et le 99,9e centile et le pire appel. Une table pleine
+ * n'est pas recopie d'un coup; le pire appel garde toutefois le prix d'une nouvelle table
+ * (allocation et octets de contrle remis  VIDE), qui grandit avec N.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Bottin.h"
+
+using namespace std;
+using namespace TP2P2;
+
+static const unsigned char VIDE = 0x80;   /*!< L'octet de contrle d'une case vide. */
+
+/*! \struct AncienneCase
+ *  \brief Une case de l'ancienne disposition: la cl et son tat dans la case mme.
+ */
+struct AncienneCase {
+   string clef;      /*!< La cl. */
+   int position;     /*!< La position de l'entre. */
+   int info;         /*!< 0 : active, 1 : vide, 2 : supprime. */
+};
+
+/*! \struct NouvelleCase
+ *  \brief Une case de la nouvelle disposition; son tat est dans l'octet de contrle.
+ */
+struct NouvelleCase {
+   string clef;      /*!< La cl. */
+   int position;     /*!< La position de l'entre. */
+};
+
+/**
+ * \fn unsigned long hacher(const string & clef)
+ * \brief Le hachage des cls des deux dispositions.
+ */
+static unsigned long hacher(const string & clef)
+{
+   unsigned long h = 0;
+   for (size_t i = 0; i < clef.size(); i++)
+      h = 37 * h + clef[i];
+   return h;
+}
+
+/**
+ * \fn unsigned char fragment(unsigned long h)
+ * \brief Les 7 bits du hachage gards dans l'octet de contrle.
+ */
+static unsigned char fragment(unsigned long h)
+{
+   return (unsigned char)((h * 0x9E3779B97F4A7C15ULL) >> 57);
+}
+
+/**
+ * \fn long premierSuivant(long n)
+ * \brief Le premier nombre premier au moins gal  n.
+ */
+static long premierSuivant(long n)
+{
+   for (;; n++)
+   {
+      bool premier = n > 1;
+      for (long d = 2; premier && d * d <= n; d++)
+         premier = n % d != 0;
+      if (premier)
+         return n;
+   }
+}
+
+/**
+ * \fn double nanosecondes(chrono::steady_clock::time_point debut, size_t nb)
+ * \brief Le temps moyen d'une opration depuis debut.
+ */
+static double nanosecondes(chrono::steady_clock::time_point debut, size_t nb)
+{
+   return chrono::duration<double, nano>(chrono::steady_clock::now() - debut).count() / nb;
+}
+
+/**
+ * \fn string telephone(mt19937 & generateur)
+ * \brief Un numro de tlphone au hasard, au format du fichier Bottin.txt.
+ */
+static string telephone(mt19937 & generateur)
+{
+   char numero[20];
+   snprintf(numero, sizeof(numero), "(%03u) %03u-%04u", unsigned(generateur() % 900 + 100),
+            unsigned(generateur() % 1000), unsigned(generateur() % 10000));
+   return numero;
+}
+
+/**
+ * \fn string nom(mt19937 & generateur)
+ * \brief Un nom de famille au hasard, parmi des noms frquents suivis d'un nombre.
+ */
+static string nom(mt19937 & generateur)
+{
+   static const char * noms[] = { "Tremblay", "Gagnon", "Roy", "Cote", "Bouchard", "Gauthier", "Morin",
+                                  "Lavoie", "Fortin", "Gagne", "Ouellet", "Pelletier", "Belanger" };
+   return string(noms[generateur() % 13]) + noms[generateur() % 13] + to_string(generateur() % 100000);
+}
+
+/**
+ * \fn string clef(const string & texte)
+ * \brief La cl d'une chane: ses chiffres et ses lettres, comme dans le Bottin.
+ */
+static string clef(const string & texte)
+{
+   string c;
+   for (size_t i = 0; i < texte.size(); i++)
+      if (isalnum((unsigned char)texte[i]))
+         c += texte[i];
+   return c;
+}
+
+/**
+ * \fn void comparer(const char * type, bool telephones, long nbCases, double remplissage)
+ * \brief Remplit les deux dispositions avec les mmes cls et affiche le temps d'une recherche.
+ */
+static void comparer(const char * type, bool telephones, long nbCases, double remplissage)
+{
+   mt19937 generateur(7);
+   vector<AncienneCase> ancienne(nbCases, AncienneCase{ "", 0, 1 });
+   vector<NouvelleCase> nouvelle(nbCases);
+   vector<unsigned char> controle(nbCases, VIDE);
+
+   // Les mmes cls sont insres dans les deux dispositions, avec le mme sondage
+   vector<string> clefs;
+   while (clefs.size() < size_t(nbCases * remplissage))
+   {
+      string c = clef(telephones ? telephone(generateur) : nom(generateur) + "Jean");
+      unsigned long h = hacher(c), pos = h % nbCases;
+      long saut = 1;
+      while (ancienne[pos].info == 0 && ancienne[pos].clef != c)
+      {
+         pos = (pos + saut) % nbCases;
+         saut += 2;
+      }
+      if (ancienne[pos].info == 0)   // doublon
+         continue;
+      ancienne[pos] = AncienneCase{ c, int(clefs.size()), 0 };
+      nouvelle[pos] = NouvelleCase{ c, int(clefs.size()) };
+      controle[pos] = fragment(h);
+      clefs.push_back(c);
+   }
+
+   vector<string> requetes;
+   for (int i = 0; i < 1000000; i++)
+      requetes.push_back(i % 2 ? clefs[generateur() % clefs.size()]
+                               : clef(telephones ? telephone(generateur) : nom(generateur)) + "x");
+
+   // Le meilleur de cinq essais pour chaque disposition
+   double tempsAncien = 1e30, tempsNouveau = 1e30;
+   size_t trouvesAncien = 0, trouvesNouveau = 0;
+   for (int essai = 0; essai < 5; essai++)
+   {
+      trouvesAncien = trouvesNouveau = 0;
+      chrono::steady_clock::time_point debut = chrono::steady_clock::now();
+      for (size_t i = 0; i < requetes.size(); i++)
+      {
+         unsigned long pos = hacher(requetes[i]) % nbCases;
+         long saut = 1;
+         while (ancienne[pos].info != 1 && ancienne[pos].clef != requetes[i])
+         {
+            pos += saut;
+            saut += 2;
+            if (pos >= (unsigned long)nbCases)
+               pos %= nbCases;
+         }
+         trouvesAncien += ancienne[pos].info == 0;
+      }
+      tempsAncien = min(tempsAncien, nanosecondes(debut, requetes.size()));
+
+      debut = chrono::steady_clock::now();
+      for (size_t i = 0; i < requetes.size(); i++)
+      {
+         unsigned long h = hacher(requetes[i]), pos = h % nbCases;
+         unsigned char f = fragment(h);
+         long saut = 1;
+         while (controle[pos] != VIDE && !(controle[pos] == f && nouvelle[pos].clef == requetes[i]))
+         {
+            pos += saut;
+            saut += 2;
+            if (pos >= (unsigned long)nbCases)
+               pos %= nbCases;
+         }
+         trouvesNouveau += controle[pos] != VIDE;
+      }
+      tempsNouveau = min(tempsNouveau, nanosecondes(debut, requetes.size()));
+   }
+
+   printf("%s %2.0f%% : ancienne %4.0f ns, octets de controle %4.0f ns (x%.2f)%s\n", type, remplissage * 100,
+          tempsAncien, tempsNouveau, tempsAncien / tempsNouveau,
+          trouvesAncien == trouvesNouveau ? "" : " RESULTATS DIFFERENTS");
+}
+
+/**
+ * \fn void mesurerBottin(long nbPersonnes)
+ * \brief Le temps de contient() dans la classe Bottin, par tlphone puis par nom.
+ */
+static void mesurerBottin(long nbPersonnes)
+{
+   mt19937 generateur(11);
+   Bottin bottin;
+   vector<string> telephones, noms;
+   while ((long)telephones.size() < nbPersonnes)
+   {
+      string t = telephone(generateur), n = nom(generateur);
+      if (bottin.contient(t) || bottin.contient(n + ", Jean"))
+         continue;
+      bottin.ajouter(n, "Jean", t, t, "");
+      telephones.push_back(t);
+      noms.push_back(n + ", Jean");
+   }
+
+   for (int type = 0; type < 2; type++)
+   {
+      const vector<string> & presents = type == 0 ? telephones : noms;
+      vector<string> requetes;
+      for (int i = 0; i < 1000000; i++)
+         requetes.push_back(i % 2 ? presents[generateur() % presents.size()]
+                                  : (type == 0 ? telephone(generateur) : nom(generateur) + ", Jean") + "x");
+
+      double temps = 1e30;
+      for (int essai = 0; essai < 5; essai++)
+      {
+         size_t trouves = 0;
+         chrono::steady_clock::time_point debut = chrono::steady_clock::now();
+         for (size_t i = 0; i < requetes.size(); i++)
+            trouves += bottin.contient(requetes[i]);
+         temps = min(temps, nanosecondes(debut, requetes.size()));
+      }
+      Occupation o = type == 0 ? bottin.getOccupationTel() : bottin.getOccupationNom();
+      printf("Bottin, %s : %4.0f ns par contient(), %2.0f%% rempli\n", type == 0 ? "telephone" : "nom",
+             temps, 100.0 * o.actives / (o.actives + o.supprimees + o.vides));
+   }
+}
+
+/**
+ * \fn void mesurerAjouts(long nbPersonnes)
+ * \brief Le temps de chaque appel  ajouter(), rsum par tranche de N.
+ */
+static void mesurerAjouts(long nbPersonnes)
+{
+   // Les employs sont prpars d'avance; 7919 est premier avec 10^7, les numros sont donc tous diffrents
+   vector<string> telephones(nbPersonnes), noms(nbPersonnes);
+   for (long i = 0; i < nbPersonnes; i++)
+   {
+      unsigned long j = (unsigned long)(i * 7919) % 10000000;
+      char numero[20];
+      snprintf(numero, sizeof(numero), "(%03lu) %03lu-%04lu", 100 + j / 10000000, j / 10000 % 1000, j % 10000);
+      telephones[i] = numero;
+      noms[i] = "Tremblay" + to_string(j);
+   }
+
+   Bottin bottin;
+   vector<double> temps(nbPersonnes);
+   for (long i = 0; i < nbPersonnes; i++)
+   {
+      chrono::steady_clock::time_point debut = chrono::steady_clock::now();
+      bottin.ajouter(noms[i], "Jean", telephones[i], telephones[i], "");
+      temps[i] = nanosecondes(debut, 1);
+   }
+
+   for (long debut = 0, fin = 1000; debut < nbPersonnes; debut = fin, fin *= 10)
+   {
+      if (fin > nbPersonnes)
+         fin = nbPersonnes;
+      vector<double> tranche(temps.begin() + debut, temps.begin() + fin);
+      double somme = 0;
+      for (size_t i = 0; i < tranche.size(); i++)
+         somme += tranche[i];
+      sort(tranche.begin(), tranche.end());
+      printf("ajouter(), N jusqu'a %8ld : moyenne %5.0f ns, p99 %6.0f ns, p99.9 %7.0f ns, max %9.0f ns\n", fin,
+             somme / tranche.size(), tranche[tranche.size() * 99 / 100], tranche[tranche.size() * 999 / 1000],
+             tranche.back());
+   }
+}
+
+/**
+ * \fn int main(int argc, char * argv[])
+ * \brief Compare les deux dispositions  50, 75 et 90% de remplissage, puis mesure le Bottin;
+ * ou, avec l'argument  latence , mesure chaque appel  ajouter().
+ */
+int main(int argc, char * argv[])
+{
+   if (argc > 1 && string(argv[1]) == "latence")
+   {
+      mesurerAjouts(argc > 2 ? atol(argv[2]) : 1000000);
+      return 0;
+   }
+
+   long nbCases = premierSuivant(argc > 1 ? atol(argv[1]) : 2000003);
+   cout << nbCases << " cases par table" << endl;
+
+   const double remplissages[] = { .5, .75, .9 };
+   for (int i = 0; i < 3; i++)
+      comparer("telephone", true, nbCases, remplissages[i]);
+   for (int i = 0; i < 3; i++)
+      comparer("nom      ", false, nbCases, remplissages[i]);
+
+   mesurerBottin(nbCases / 2);
+   return 0;
+}
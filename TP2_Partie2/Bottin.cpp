@@ -68,8 +68,8 @@ Bottin::Bottin(std::istream &fichier, int &nbCollisions) :
       tabEntree.push_back(Entree(nom, prenom, tel, fax, courriel));
 
       // insertion dans les deux tables de dispersions
-      _inserer(tel, i);
-      _inserer((nom + prenom), i);
+      _inserer(Clef(tel), i);
+      _inserer(Clef(nom, prenom), i);
    }
 
    nbCollisions = collisionsTel + collisionsNom;
@@ -83,13 +83,23 @@ void Bottin::rendreVide()
    tailleTel = 0;
    tailleNom = 0;
 
+   // les entres ne sont plus accessibles: on les libre
+   tabEntree.clear();
+   entreesSupprimees = 0;
+
    // Pour la table de dispersion avec la cl Tlphone
-   for (unsigned int i = 0; i < tabTelephone.size(); i++)
-      tabTelephone[i].info = VIDE;
+   ctrlTelephone.assign(tabTelephone.size(), VIDE);
 
    // Pour la table de dispersion avec la cl Nom/Prnom
-   for (unsigned int i = 0; i < tabNomPrenom.size(); i++)
-      tabNomPrenom[i].info = VIDE;
+   ctrlNomPrenom.assign(tabNomPrenom.size(), VIDE);
+
+   // une migration en cours est abandonne: ses entres sont vides elles aussi
+   vector<HashEntree>().swap(ancienneTelephone);
+   vector<HashEntree>().swap(ancienneNomPrenom);
+   vector<unsigned char>().swap(ancienCtrlTelephone);
+   vector<unsigned char>().swap(ancienCtrlNomPrenom);
+   migrationTel = 0;
+   migrationNom = 0;
 }
 
 /**
@@ -102,17 +112,7 @@ void Bottin::rendreVide()
  */
 bool Bottin::contient(const std::string & c)
 {
-   int oldCollisionsTel = collisionsTel;
-   int oldCollisionsNom = collisionsNom;
-
-   string clef = _creerClef(c);
-   int positionCourante = _trouverPosition(clef);
-
-   // on conserve le nombre de collisions avant l'appel de la mthode _trouverPosition()
-   collisionsTel = oldCollisionsTel;
-   collisionsNom = oldCollisionsNom;
-
-   return _estActive(clef, positionCourante);
+   return _contient(Clef(c));
 }
 
 /**
@@ -130,7 +130,7 @@ void Bottin::ajouter(const std::string & nom, const std::string & prenom, const
                      const std::string & fax, const std::string & courriel)
 {
    // la personne ne doit pas tre prsente dans la table
-   if (contient(tel) || contient(nom + prenom))
+   if (_contient(Clef(tel)) || _contient(Clef(nom, prenom)))
       throw std::logic_error ("ajouter: l'entre est dj prsente dans la table.");
 
    // ajout dans le tableau des entres
@@ -139,8 +139,8 @@ void Bottin::ajouter(const std::string & nom, const std::string & prenom, const
    // insertion dans les tables de dispersions
    // la position du tableau des entres = tabEntree.size() - 1
    int position = tabEntree.size() - 1;
-   _inserer(tel, position);
-   _inserer((nom + prenom), position);
+   _inserer(Clef(tel), position);
+   _inserer(Clef(nom, prenom), position);
 }
 
 /**
@@ -154,8 +154,8 @@ void Bottin::supprimer(const std::string & c)
    int oldCollisionsTel = collisionsTel;
    int oldCollisionsNom = collisionsNom;
 
-   string clef = _creerClef(c);
-   int positionCourante = _trouverPosition(clef);
+   Clef clef(c);
+   int positionCourante = _trouverPosition(clef, _hacher(clef));
 
    if (!_estActive(clef, positionCourante))
       throw std::logic_error ("supprimer: l'entre n'est pas prsente dans la table.\n");
@@ -164,24 +164,22 @@ void Bottin::supprimer(const std::string & c)
    // Suppression des entres dans les deux tables de dispersions
    int positionEntree = 0;
 
-   if (isdigit(clef[0]))
+   if (_estTelephone(clef))
    {
       // Si la cl est un numro de tlphone
 
       // on rcupre la position associe  la cl dans le HashEntree
       positionEntree = tabTelephone[positionCourante].position;
 
-      // pour rcuprer le nom et le prnom dans tabEntree
-      string nom = tabEntree[positionEntree].nom;
-      string prenom = tabEntree[positionEntree].prenom;
+      // la cl Nom/Prnom est lue directement dans tabEntree
+      Clef clefNom(tabEntree[positionEntree].nom, tabEntree[positionEntree].prenom);
 
       // on trouve la position de l'entre dans tabNomPrenom
-      clef = _creerClef(nom + prenom);
-      int positionNom = _trouverPosition(clef);
+      int positionNom = _trouverPosition(clefNom, _hacher(clefNom));
 
       // on supprime dans les deux tables de dispersions
-      tabNomPrenom[positionNom].info = SUPPRIMEE;
-      tabTelephone[positionCourante].info = SUPPRIMEE;
+      ctrlNomPrenom[positionNom] = SUPPRIMEE;
+      ctrlTelephone[positionCourante] = SUPPRIMEE;
    }
    else
    {
@@ -190,21 +188,28 @@ void Bottin::supprimer(const std::string & c)
       // on rcupre la position associe  la cl dans le HashEntree
       positionEntree = tabNomPrenom[positionCourante].position;
 
-      // pour rcuprer le numro de tlphone dans tabEntree
-      string tel = tabEntree[positionEntree].tel;
+      // la cl tlphone est lue directement dans tabEntree
+      Clef clefTel(tabEntree[positionEntree].tel);
 
       // on trouve la position de l'entre dans tabTelephone
-      clef = _creerClef(tel);
-      int positionTel = _trouverPosition(clef);
+      int positionTel = _trouverPosition(clefTel, _hacher(clefTel));
 
       // on supprime dans les deux tables de dispersions
-      tabTelephone[positionTel].info = SUPPRIMEE;
-      tabNomPrenom[positionCourante].info = SUPPRIMEE;
+      ctrlTelephone[positionTel] = SUPPRIMEE;
+      ctrlNomPrenom[positionCourante] = SUPPRIMEE;
    }
 
+   // l'entre reste dans tabEntree jusqu'au prochain compactage
+   tabEntree[positionEntree].supprimee = true;
+   entreesSupprimees++;
+
    // on conserve le nombre de collisions avant l'appel de la mthode _trouverPosition()
    collisionsTel = oldCollisionsTel;
    collisionsNom = oldCollisionsNom;
+
+   // si les entres supprimes dpassent le TAUX_SUPPRIMEES_MAX
+   if ((entreesSupprimees/float(tabEntree.size()))*100 > TAUX_SUPPRIMEES_MAX)
+      _compacter();
 }
 
 /**
@@ -227,6 +232,26 @@ int Bottin::getCollisionsNom() const
    return collisionsNom;
 }
 
+/**
+ * \fn Occupation Bottin::getOccupationTel() const
+ *
+ * \return L'occupation des cases de tabTelephone.
+ */
+Occupation Bottin::getOccupationTel() const
+{
+   return _occupation(ctrlTelephone, ancienCtrlTelephone);
+}
+
+/**
+ * \fn Occupation Bottin::getOccupationNom() const
+ *
+ * \return L'occupation des cases de tabNomPrenom.
+ */
+Occupation Bottin::getOccupationNom() const
+{
+   return _occupation(ctrlNomPrenom, ancienCtrlNomPrenom);
+}
+
 /**
  * \fn Employe Bottin::trouverAvecNomPrenom(const std::string & c, int &nbCollisions)
  *
@@ -239,8 +264,8 @@ Employe Bottin::trouverAvecNomPrenom(const std::string & c, int &nbCollisions)
 {
    int collisionEmploye = collisionsNom;
 
-   string clef = _creerClef(c);
-   int positionCourante = _trouverPosition(clef);
+   Clef clef(c);
+   int positionCourante = _trouverPosition(clef, _hacher(clef));
 
    // on vrifie que l'entre est prsente dans la table
    if (!_estActive(clef, positionCourante))
@@ -275,8 +300,8 @@ Employe Bottin::trouverAvecTelephone(const std::string & c, int &nbCollisions)
 {
    int collisionEmploye = collisionsTel;
 
-   string clef = _creerClef(c);
-   int positionCourante = _trouverPosition(clef);
+   Clef clef(c);
+   int positionCourante = _trouverPosition(clef, _hacher(clef));
 
    // on vrifie que l'entre est prsente dans la table
    if (!_estActive(clef, positionCourante))
@@ -324,195 +349,558 @@ string Bottin::infosEmploye(const Employe& e) const
 //-------------------------------------------------------------------------------------------------
 
 /**
- * \fn std::string Bottin::_creerClef(const std::string & c)
+ * \fn std::string Bottin::_creerClef(Clef c)
  *
- * \param[in] c : une chane de caractres reprsentant un numro de tlphone
- *                ou une paire Nom/Prnom.
+ * \param[in] c : une cl lue dans un numro de tlphone ou une paire Nom/Prnom.
  *
  * \return Une chane de caractres contenant la cl pour le hachage.
  */
-std::string Bottin::_creerClef(const std::string & c)
+std::string Bottin::_creerClef(Clef c)
 {
    string clef;
+   char caractere;
+
+   // Clef::lire() ne donne que les chiffres et les lettres
+   while (c.lire(caractere))
+      clef += caractere;
+
+   return clef;
+}
 
-   // on ne garde que les chiffres et les lettres
-   for (unsigned int i = 0; i < c.size(); i++)
+/**
+ * \fn bool Bottin::_estTelephone(Clef clef)
+ *
+ * \param[in] clef : la cl de hachage.
+ *
+ * \return VRAI si la cl commence par un chiffre, FAUX sinon.
+ */
+bool Bottin::_estTelephone(Clef clef)
+{
+   char caractere;
+   return clef.lire(caractere) && isdigit(static_cast<unsigned char>(caractere));
+}
+
+/**
+ * \fn const std::string & Bottin::_clefGardee(bool telephone, int position) const
+ *
+ * \param[in] telephone : VRAI pour la cl tlphone, FAUX pour la cl Nom/Prnom.
+ * \param[in] position : la position de l'entre dans le tableau tabEntree.
+ *
+ * \return La cl garde dans l'entre.
+ */
+const std::string & Bottin::_clefGardee(bool telephone, int position) const
+{
+   if (telephone)
+      return tabEntree[position].clefTel;
+   else
+      return tabEntree[position].clefNomPrenom;
+}
+
+/**
+ * \fn bool Bottin::_memeClef(const std::string & clefGardee, Clef clef)
+ *
+ * \param[in] clefGardee : une cl garde dans tabEntree, dj cre par _creerClef().
+ * \param[in] clef : la cl recherche.
+ *
+ * \return VRAI si les deux cls sont identiques, FAUX sinon.
+ */
+bool Bottin::_memeClef(const std::string & clefGardee, Clef clef)
+{
+   size_t i = 0;
+   char caractere;
+
+   while (clef.lire(caractere))
    {
-      if (isdigit(c[i]) || isalpha(c[i]))
-         clef += c[i];
+      if (i == clefGardee.size() || clefGardee[i] != caractere)
+         return false;
+      i++;
    }
 
-   return clef;
+   return i == clefGardee.size();
+}
+/**
+ * \fn bool Bottin::_contient(const Clef & clef)
+ *
+ * \param[in] clef : la cl de hachage.
+ *
+ * \return VRAI si la cl est prsente, FAUX sinon.
+ */
+bool Bottin::_contient(const Clef & clef)
+{
+   int oldCollisionsTel = collisionsTel;
+   int oldCollisionsNom = collisionsNom;
+
+   int positionCourante = _trouverPosition(clef, _hacher(clef));
+
+   // on conserve le nombre de collisions avant l'appel de la mthode _trouverPosition()
+   collisionsTel = oldCollisionsTel;
+   collisionsNom = oldCollisionsNom;
+
+   return _estActive(clef, positionCourante);
 }
 
 /**
- * \fn bool Bottin::_estActive(const std::string & clef, int positionCourante) const
+ * \fn bool Bottin::_estActive(const Clef & clef, int positionCourante) const
  *
  * \param[in] clef : la cl de hachage.
  * \param[in] positionCourante : la position courante  rechercher.
  *
  * \return VRAI si l'entre  la positionCourante est active (occupe), FAUX sinon.
  */
-bool Bottin::_estActive(const std::string & clef, int positionCourante) const
+bool Bottin::_estActive(const Clef & clef, int positionCourante) const
 {
-   if (isdigit(clef[0]))
+   if (_estTelephone(clef))
    {
-      return tabTelephone[positionCourante].info == ACTIVE;
+      return ctrlTelephone[positionCourante] < VIDE;
    }
    else
    {
-      return tabNomPrenom[positionCourante].info == ACTIVE;
+      return ctrlNomPrenom[positionCourante] < VIDE;
    }
 }
 
 /**
- * \fn void Bottin::_inserer(const std::string & c, const int & pos)
+ * \fn void Bottin::_inserer(const Clef & clef, const int & pos)
  *
- * \param[in] c : une chane de caractres reprsentant un numro de tlphone
- *                ou une paire Nom/Prnom.
+ * \param[in] clef : une cl lue dans un numro de tlphone ou une paire Nom/Prnom.
  * \param[in] pos : la position de l'entre dans le tableau tabEntree.
  */
-void Bottin::_inserer(const std::string & c, const int & pos)
+void Bottin::_inserer(const Clef & clef, const int & pos)
 {
-   string clef = _creerClef(c);
-   int positionCourante = _trouverPosition(clef);
+   bool telephone = _estTelephone(clef);
+
+   // l'insertion avance la migration de sa table, s'il y en a une
+   _migrer(telephone, PAS_MIGRATION);
+
+   uint64_t hachage = _hacher(clef);
+   int positionCourante = _trouverPosition(clef, hachage);
 
    // on vrifie que l'entre n'est pas dj prsente dans la table
    if (_estActive(clef, positionCourante))
       throw std::logic_error ("inserer: l'entre est dj prsente dans la table.\n");
 
-   // on insre l'entre dans la table de dispersion
-   if (isdigit(clef[0]))
+   // on insre l'entre dans la table de dispersion; la cl reste dans tabEntree
+   // une case supprime rutilise tait dj compte dans la taille
+   if (telephone)
    {
-      tabTelephone[positionCourante] = HashEntree(clef, pos, ACTIVE);
+      if (ctrlTelephone[positionCourante] == VIDE)
+         tailleTel++;
+
+      tabTelephone[positionCourante] = HashEntree(hachage, pos);
+      ctrlTelephone[positionCourante] = _fragment(hachage);
 
       // si la taille de tabTelephone dpasse le TAUX_MAX
-      if ((++tailleTel/float(tabTelephone.size()))*100 > TAUX_MAX)
-         _rehash();
+      if ((tailleTel/float(tabTelephone.size()))*100 > TAUX_MAX)
+         _rehash(true);
    }
    else
    {
-      tabNomPrenom[positionCourante] = HashEntree(clef, pos, ACTIVE);
+      if (ctrlNomPrenom[positionCourante] == VIDE)
+         tailleNom++;
+
+      tabNomPrenom[positionCourante] = HashEntree(hachage, pos);
+      ctrlNomPrenom[positionCourante] = _fragment(hachage);
 
       // si la taille de tabNomPrenom dpasse le TAUX_MAX
-      if ((++tailleNom/float(tabNomPrenom.size()))*100 > TAUX_MAX)
-         _rehash();
+      if ((tailleNom/float(tabNomPrenom.size()))*100 > TAUX_MAX)
+         _rehash(false);
+   }
+}
+
+/**
+ * \fn int Bottin::_placer(bool telephone, const HashEntree & entree)
+ *
+ * \param[in] telephone : VRAI pour tabTelephone, FAUX pour tabNomPrenom.
+ * \param[in] entree : une entre de l'ancienne table, avec son hachage.
+ *
+ * \return La position de l'entre dans la table courante.
+ */
+int Bottin::_placer(bool telephone, const HashEntree & entree)
+{
+   vector<HashEntree> & table = telephone ? tabTelephone : tabNomPrenom;
+   vector<unsigned char> & ctrl = telephone ? ctrlTelephone : ctrlNomPrenom;
+
+   unsigned long positionCourante = entree.hachage % table.size();
+   int offset = 1;
+
+   // la cl n'est pas dans la table courante: on s'arrte  la premire case libre
+   while (ctrl[positionCourante] < VIDE)
+   {
+      positionCourante += offset;
+      offset += 2;
+      if (positionCourante >= table.size())
+      {
+         positionCourante -= table.size();
+      }
+   }
+
+   // une case supprime rutilise tait dj compte dans la taille
+   if (ctrl[positionCourante] == VIDE)
+   {
+      if (telephone)
+         tailleTel++;
+      else
+         tailleNom++;
    }
+
+   table[positionCourante] = entree;
+   ctrl[positionCourante] = _fragment(entree.hachage);
+
+   return positionCourante;
 }
 
 /**
- * \fn int Bottin::_trouverPosition(const std::string & clef)
+ * \fn void Bottin::_migrer(bool telephone, unsigned int nbCases)
+ *
+ * \param[in] telephone : VRAI pour migrer tabTelephone, FAUX pour tabNomPrenom.
+ * \param[in] nbCases : le nombre de cases de l'ancienne table  migrer.
+ */
+void Bottin::_migrer(bool telephone, unsigned int nbCases)
+{
+   vector<HashEntree> & ancienne = telephone ? ancienneTelephone : ancienneNomPrenom;
+   vector<unsigned char> & ancienCtrl = telephone ? ancienCtrlTelephone : ancienCtrlNomPrenom;
+   unsigned int & migration = telephone ? migrationTel : migrationNom;
+
+   if (ancienne.empty())
+      return;
+
+   for (; nbCases > 0 && migration < ancienne.size(); nbCases--, migration++)
+   {
+      if (ancienCtrl[migration] < VIDE)
+      {
+         _placer(telephone, ancienne[migration]);
+         ancienCtrl[migration] = SUPPRIMEE;
+      }
+   }
+
+   // toutes les cases sont migres: on libre l'ancienne table
+   if (migration == ancienne.size())
+   {
+      vector<HashEntree>().swap(ancienne);
+      vector<unsigned char>().swap(ancienCtrl);
+      migration = 0;
+   }
+}
+/**
+ * \fn int Bottin::_trouverPosition(const Clef & clef, std::uint64_t hachage)
  *
  * \param[in] clef : la cl de hachage.
+ * \param[in] hachage : le hachage de la cl, donn par _hacher().
  *
  * \return La position courante dans la table de dispersion.
  */
-int Bottin::_trouverPosition(const std::string & clef)
+int Bottin::_trouverPosition(const Clef & clef, std::uint64_t hachage)
 {
-   unsigned long positionCourante = 0;
+   // si la cl est un numro de tlphone, on cherche dans tabTelephone;
+   // sinon, c'est une paire Nom/Prnom
+   bool telephone = _estTelephone(clef);
+   vector<HashEntree> & ancienne = telephone ? ancienneTelephone : ancienneNomPrenom;
+   vector<unsigned char> & ancienCtrl = telephone ? ancienCtrlTelephone : ancienCtrlNomPrenom;
+   int & collisions = telephone ? collisionsTel : collisionsNom;
+
+   // pendant une migration, la cl peut tre encore dans l'ancienne table:
+   // elle est alors dplace tout de suite dans la table courante. Comme les
+   // rinsertions d'un redimensionnement, ce sondage ne compte pas de collisions
+   if (!ancienne.empty())
+   {
+      int collisionsAnciennes = 0;
+      int positionAncienne = _sonder(ancienne, ancienCtrl, telephone, clef, hachage, collisionsAnciennes);
+      if (positionAncienne < int(ancienne.size()) && ancienCtrl[positionAncienne] < VIDE)
+      {
+         ancienCtrl[positionAncienne] = SUPPRIMEE;
+         return _placer(telephone, ancienne[positionAncienne]);
+      }
+   }
+
+   if (telephone)
+      return _sonder(tabTelephone, ctrlTelephone, true, clef, hachage, collisions);
+   else
+      return _sonder(tabNomPrenom, ctrlNomPrenom, false, clef, hachage, collisions);
+}
+
+/**
+ * \fn int Bottin::_sonder(const std::vector<HashEntree> & table, const std::vector<unsigned char> & ctrl,
+ *                         bool telephone, const Clef & clef, std::uint64_t hachage, int & collisions) const
+ *
+ * \param[in] table : la table de dispersion.
+ * \param[in] ctrl : les octets de contrle de la table.
+ * \param[in] telephone : VRAI si la table est sur la cl tlphone, FAUX sur la cl Nom/Prnom.
+ * \param[in] clef : la cl de hachage.
+ * \param[in] hachage : le hachage de la cl, donn par _hacher().
+ * \param[in,out] collisions : le compteur de collisions de la table.
+ *
+ * \return La position de la cl, ou celle o l'insrer, ou la taille de la table si aucune case
+ *         visite n'est libre.
+ */
+int Bottin::_sonder(const std::vector<HashEntree> & table, const std::vector<unsigned char> & ctrl,
+                    bool telephone, const Clef & clef, std::uint64_t hachage, int & collisions) const
+{
+   unsigned char fragment = _fragment(hachage);
+   unsigned long positionCourante = hachage % table.size();
+   unsigned long premiereSupprimee = table.size();  // aucune case supprime rencontre
+   unsigned long nbSondages = 0;
    int offset = 1;
 
-   if (isdigit(clef[0]))
+   // Redispersion si collision...
+   // On ne lit que les octets de contrle; la cl garde dans tabEntree n'est compare que si le
+   // fragment, puis le hachage complet gard dans l'entre, correspondent.
+   // Sur une taille premire, le sondage quadratique ne visite que (taille + 1) / 2 cases
+   // distinctes: une ancienne table, remplie juste au-del du TAUX_MAX, peut n'en avoir aucune vide
+   while (ctrl[positionCourante] != VIDE && nbSondages++ < (table.size() + 1) / 2)
    {
-      // si la cl est un numro de tlphone
+      if (ctrl[positionCourante] == fragment && table[positionCourante].hachage == hachage
+          && _memeClef(_clefGardee(telephone, table[positionCourante].position), clef))
+         return positionCourante;
+
+      if (ctrl[positionCourante] == SUPPRIMEE && premiereSupprimee == table.size())
+         premiereSupprimee = positionCourante;
 
-      for (unsigned int i = 0; i < clef.length(); i++)
-         positionCourante = 37 * positionCourante + clef[i];
+      collisions++;
+      positionCourante += offset;  // Calcule le i-ime sondage
+      offset += 2;
+      if (positionCourante >= table.size())
+      {
+         positionCourante -= table.size();
+      }
+   }
 
-      positionCourante %= tabTelephone.size();
+   // la cl est absente: une insertion rutilise la premire case supprime
+   if (premiereSupprimee != table.size())
+      return premiereSupprimee;
 
-      if (positionCourante < 0)
-         positionCourante += tabTelephone.size();
+   // toutes les cases visites sont occupes (dans une ancienne table seulement)
+   if (ctrl[positionCourante] != VIDE)
+      return table.size();
 
-      // Redispersion si collision...
-      while (tabTelephone[positionCourante].info != VIDE &&
-             tabTelephone[positionCourante].clef != clef)
+   return positionCourante;
+}
+/**
+ * \fn std::uint64_t Bottin::_hacher(Clef clef)
+ *
+ * \param[in] clef : la cl de hachage.
+ *
+ * \return Le hachage de 64 bits de la cl.
+ */
+std::uint64_t Bottin::_hacher(Clef clef)
+{
+   // les nombres premiers de xxHash64
+   const uint64_t PREMIER1 = 0x9E3779B185EBCA87ULL;
+   const uint64_t PREMIER2 = 0xC2B2AE3D27D4EB4FULL;
+   const uint64_t PREMIER3 = 0x165667B19E3779F9ULL;
+   const uint64_t PREMIER4 = 0x85EBCA77C2B2AE63ULL;
+   const uint64_t PREMIER5 = 0x27D4EB2F165667C5ULL;
+
+   uint64_t hachage = PREMIER5;
+   uint64_t bloc = 0;          // les octets lus, pas encore mlangs
+   unsigned int nbOctets = 0;  // le nombre d'octets dans bloc
+   size_t longueur = 0;
+   char caractere;
+
+   // blocs de 8 octets, assembls au fil de la lecture
+   while (clef.lire(caractere))
+   {
+      bloc |= static_cast<uint64_t>(static_cast<unsigned char>(caractere)) << (8 * nbOctets);
+      longueur++;
+
+      if (++nbOctets == 8)
       {
-         collisionsTel++;
-         positionCourante += offset;  // Calcule le i-ime sondage
-         offset += 2;
-         if (positionCourante >= tabTelephone.size())
-         {
-            positionCourante -= tabTelephone.size();
-         }
+         bloc *= PREMIER2;
+         bloc = (bloc << 31) | (bloc >> 33);
+         bloc *= PREMIER1;
+         hachage ^= bloc;
+         hachage = ((hachage << 27) | (hachage >> 37)) * PREMIER1 + PREMIER4;
+         bloc = 0;
+         nbOctets = 0;
       }
    }
-   else
+
+   // un bloc de 4 octets
+   if (nbOctets >= 4)
    {
-      // sinon, c'est une paire Nom/Prnom
+      hachage ^= (bloc & 0xFFFFFFFFULL) * PREMIER1;
+      hachage = ((hachage << 23) | (hachage >> 41)) * PREMIER2 + PREMIER3;
+      bloc >>= 32;
+      nbOctets -= 4;
+   }
+
+   // les derniers octets, un  un
+   for (; nbOctets > 0; nbOctets--)
+   {
+      hachage ^= (bloc & 0xFF) * PREMIER5;
+      hachage = ((hachage << 11) | (hachage >> 53)) * PREMIER1;
+      bloc >>= 8;
+   }
+
+   // xxHash64 part de la longueur; lue au vol, la cl ne la donne qu' la fin
+   hachage += longueur;
 
-      for (unsigned int i = 0; i < clef.length(); i++)
-         positionCourante = 37 * positionCourante + clef[i];
+   // mlange final: chaque bit du rsultat dpend de tous les octets de la cl
+   hachage ^= hachage >> 33;
+   hachage *= PREMIER2;
+   hachage ^= hachage >> 29;
+   hachage *= PREMIER3;
+   hachage ^= hachage >> 32;
 
-      positionCourante %= tabNomPrenom.size();
+   return hachage;
+}
 
-      if (positionCourante < 0)
-         positionCourante += tabNomPrenom.size();
+/**
+ * \fn unsigned char Bottin::_fragment(std::uint64_t hachage)
+ *
+ * \param[in] hachage : le hachage d'une cl.
+ *
+ * \return Un entier de 0  127,  garder dans l'octet de contrle d'une case occupe.
+ */
+unsigned char Bottin::_fragment(std::uint64_t hachage)
+{
+   return static_cast<unsigned char>(hachage >> 57);
+}
+
+/**
+ * \fn void Bottin::_rehash(bool telephone)
+ *
+ * \param[in] telephone : VRAI pour agrandir tabTelephone, FAUX pour tabNomPrenom.
+ */
+void Bottin::_rehash(bool telephone)
+{
+   vector<HashEntree> & table = telephone ? tabTelephone : tabNomPrenom;
+   vector<unsigned char> & ctrl = telephone ? ctrlTelephone : ctrlNomPrenom;
+   vector<HashEntree> & ancienne = telephone ? ancienneTelephone : ancienneNomPrenom;
+   vector<unsigned char> & ancienCtrl = telephone ? ancienCtrlTelephone : ancienCtrlNomPrenom;
+
+   // une migration pas encore termine est acheve d'abord
+   _migrer(telephone, ancienne.size());
+
+   // la table courante devient l'ancienne table; elle est change, pas copie
+   ancienne.swap(table);
+   ancienCtrl.swap(ctrl);
+
+   // la taille compte les cases occupes ou supprimes de la table courante: les entres
+   // actives y reviennent une  une avec _placer(), les cases supprimes restent derrire
+   if (telephone)
+      tailleTel = 0;
+   else
+      tailleNom = 0;
+
+   // Cration d'une nouvelle table 2 fois plus grande; les insertions suivantes y migrent
+   // les entres avec _migrer(), sans les comparer et sans compter de collisions
+   table.resize(_premierSuivant(2 * ancienne.size()));
+   ctrl.assign(table.size(), VIDE);
+}
+
+/**
+ * \fn void Bottin::_compacter()
+ */
+void Bottin::_compacter()
+{
+   // on garde les entres actives, dans le mme ordre, et on note leur nouvelle position
+   vector<int> nouvellePosition(tabEntree.size(), -1);
+   deque<Entree> entrees;
 
-      // Redispersion si collision...
-      while (tabNomPrenom[positionCourante].info != VIDE &&
-             tabNomPrenom[positionCourante].clef != clef)
+   for (unsigned int i = 0; i < tabEntree.size(); i++)
+   {
+      if (!tabEntree[i].supprimee)
       {
-         collisionsNom++;
-         positionCourante += offset;  // Calcule le i-ime sondage
-         offset += 2;
-         if (positionCourante >= tabNomPrenom.size())
-         {
-            positionCourante -= tabNomPrenom.size();
-         }
+         nouvellePosition[i] = entrees.size();
+         entrees.push_back(std::move(tabEntree[i]));
       }
    }
 
-   return positionCourante;
+   tabEntree.swap(entrees);
+   entreesSupprimees = 0;
+
+   // les deux tables pointent dans tabEntree: on les reconstruit
+   _reconstruire(true, nouvellePosition);
+   _reconstruire(false, nouvellePosition);
 }
 
 /**
- * \fn void Bottin::_rehash()
+ * \fn void Bottin::_reconstruire(bool telephone, const std::vector<int> & nouvellePosition)
+ *
+ * \param[in] telephone : VRAI pour reconstruire tabTelephone, FAUX pour tabNomPrenom.
+ * \param[in] nouvellePosition : la nouvelle position dans tabEntree de chaque ancienne position,
+ *                               ou -1 pour une entre supprime.
  */
-void Bottin::_rehash()
+void Bottin::_reconstruire(bool telephone, const std::vector<int> & nouvellePosition)
 {
-   vector<HashEntree> oldTabTelephone = tabTelephone;
-   vector<HashEntree> oldTabNomPrenom = tabNomPrenom;
+   vector<HashEntree> & table = telephone ? tabTelephone : tabNomPrenom;
+   vector<unsigned char> & ctrl = telephone ? ctrlTelephone : ctrlNomPrenom;
+   vector<HashEntree> & ancienne = telephone ? ancienneTelephone : ancienneNomPrenom;
+   vector<unsigned char> & ancienCtrl = telephone ? ancienCtrlTelephone : ancienCtrlNomPrenom;
+
+   // la table et l'ancienne table (pendant une migration) sont mises de ct
+   vector<HashEntree> oldTable;
+   vector<unsigned char> oldCtrl;
+   vector<HashEntree> oldAncienne;
+   vector<unsigned char> oldAncienCtrl;
+   oldTable.swap(table);
+   oldCtrl.swap(ctrl);
+   oldAncienne.swap(ancienne);
+   oldAncienCtrl.swap(ancienCtrl);
+
+   if (telephone)
+   {
+      tailleTel = 0;
+      migrationTel = 0;
+   }
+   else
+   {
+      tailleNom = 0;
+      migrationNom = 0;
+   }
 
-   // on veut conserver le nombre de collisions avant cette opration
-   // les collisions ont dj t calcules sur les insertions qui sont dj dans les tables
-   int oldCollisionsTel = collisionsTel;
-   int oldCollisionsNom = collisionsNom;
+   // comme au chargement d'un fichier, la taille suit le nombre d'entres multipli par 1.3,
+   // doubl pour rester sous le TAUX_MAX
+   table.resize(_premierSuivant(2 * tabEntree.size() * 1.3));
+   ctrl.assign(table.size(), VIDE);
 
-   // Cration de nouvelles tables 2 fois plus grandes
-   tabTelephone.resize(_premierSuivant(2 * oldTabTelephone.size()));
-   for (unsigned int j = 0; j < tabTelephone.size(); j++)
+   // les cls actives sont places avec leur hachage gard et leur nouvelle position
+   for (unsigned int i = 0; i < oldTable.size(); i++)
    {
-      tabTelephone[j].info = VIDE;
+      if (oldCtrl[i] < VIDE)
+         _placer(telephone, HashEntree(oldTable[i].hachage, nouvellePosition[oldTable[i].position]));
    }
 
-   tabNomPrenom.resize(_premierSuivant(2 * oldTabNomPrenom.size()));
-   for (unsigned int j = 0; j < tabNomPrenom.size(); j++)
+   for (unsigned int i = 0; i < oldAncienne.size(); i++)
    {
-      tabNomPrenom[j].info = VIDE;
+      if (oldAncienCtrl[i] < VIDE)
+         _placer(telephone, HashEntree(oldAncienne[i].hachage, nouvellePosition[oldAncienne[i].position]));
    }
+}
 
-   // Copie des tables
-   tailleTel = 0;
-   tailleNom = 0;
+/**
+ * \fn Occupation Bottin::_occupation(const std::vector<unsigned char> & ctrl,
+ *                                    const std::vector<unsigned char> & ancienCtrl)
+ *
+ * \param[in] ctrl : les octets de contrle d'une table.
+ * \param[in] ancienCtrl : les octets de contrle de son ancienne table, vide hors migration.
+ *
+ * \return Le nombre de cases de la table dans chaque tat, et de cls  migrer.
+ */
+Occupation Bottin::_occupation(const std::vector<unsigned char> & ctrl,
+                               const std::vector<unsigned char> & ancienCtrl)
+{
+   Occupation occupation = { 0, 0, 0, 0 };
 
-   for (unsigned int i = 0; i < oldTabTelephone.size(); i++)
+   for (unsigned int i = 0; i < ctrl.size(); i++)
    {
-      if (oldTabTelephone[i].info == ACTIVE)
-         _inserer(oldTabTelephone[i].clef, oldTabTelephone[i].position);
+      if (ctrl[i] == VIDE)
+         occupation.vides++;
+      else if (ctrl[i] == SUPPRIMEE)
+         occupation.supprimees++;
+      else
+         occupation.actives++;
    }
 
-   for (unsigned int i = 0; i < oldTabNomPrenom.size(); i++)
+   // les cases dj migres de l'ancienne table sont marques supprimes
+   for (unsigned int i = 0; i < ancienCtrl.size(); i++)
    {
-      if (oldTabNomPrenom[i].info == ACTIVE)
-         _inserer(oldTabNomPrenom[i].clef, oldTabNomPrenom[i].position);
+      if (ancienCtrl[i] < VIDE)
+         occupation.aMigrer++;
    }
 
-   // on conserve le nombre de collisions avant l'appel de la fonction _rehash()
-   collisionsTel = oldCollisionsTel;
-   collisionsNom = oldCollisionsNom;
+   return occupation;
 }
-
 /**
  * \fn bool Bottin::_premier(int n)
  *
@@ -11,9 +11,11 @@
 
 #include <stdexcept>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <fstream>#include <string>
 #include <sstream>#include <vector>
+#include <deque>
 
 /**
  * \namespace TP2P2
@@ -35,6 +37,16 @@ typedef struct Personne {
   std::string courriel;    /*!< L'adresse courriel de la personne. */
 } Employe;
 
+/*! \struct Occupation
+ *  \brief Structure pour dcrire l'occupation des cases d'une table de dispersion du bottin.
+ */
+struct Occupation {
+  unsigned int actives;     /*!< Le nombre de cases occupes par une cl. */
+  unsigned int supprimees;  /*!< Le nombre de cases supprimes, que le sondage traverse encore. */
+  unsigned int vides;       /*!< Le nombre de cases vides. */
+  unsigned int aMigrer;     /*!< Le nombre de cls encore dans l'ancienne table, pendant une migration. */
+};
+
 /**
  * \class Bottin
  *
@@ -45,6 +57,22 @@ typedef struct Personne {
  * Nom/Prnom de la personne.
  *
  * Les collisions des deux tables sont gres par adressage ouvert avec redispersion quadratique.
+ * Le hachage d'une cl (64 bits,  la manire de xxHash) n'est calcul qu'une fois: il est gard
+ * dans son entre et resservi pour sonder, pour carter les cls diffrentes et pour redimensionner.
+ * Une recherche lit la cl directement dans la chane reue, en sautant au vol ce qui n'est ni un
+ * chiffre ni une lettre: elle n'alloue aucune chane temporaire.
+ * Chaque table a un tableau parallle d'octets de contrle: un octet dit si la case est vide,
+ * supprime ou occupe et, si elle est occupe, garde 7 bits du hachage de sa cl. Le sondage
+ * ne lit que ces octets; la cl d'une case n'est compare que si son fragment correspond.
+ *
+ * Une table pleine n'est pas recopie d'un coup: elle est mise de ct, une table deux fois plus
+ * grande la remplace, et chaque insertion y migre quelques cases de l'ancienne. Pendant la
+ * migration, une recherche regarde aussi l'ancienne table et y prend la cl si elle s'y trouve.
+ * Aucune insertion ne paie donc le prix de toute la table, et l'autre table n'est pas touche.
+ *
+ * Une insertion rutilise la premire case supprime de son sondage. Quand les entres supprimes
+ * dpassent TAUX_SUPPRIMEES_MAX du tableau des entres, un compactage retire ces entres et
+ * reconstruit les deux tables, sans cases supprimes et  la mesure des entres qui restent.
  */
 class Bottin
 {
@@ -134,6 +162,20 @@ public:
     */
    int getCollisionsNom() const;
 
+   /**
+    * \brief Cette mthode dcrit l'occupation de la table de dispersion tabTelephone.
+    *
+    * \post Le nombre de cases actives, supprimes et vides, et de cls  migrer, est retourn.
+    */
+   Occupation getOccupationTel() const;
+
+   /**
+    * \brief Cette mthode dcrit l'occupation de la table de dispersion tabNomPrenom.
+    *
+    * \post Le nombre de cases actives, supprimes et vides, et de cls  migrer, est retourn.
+    */
+   Occupation getOccupationNom() const;
+
    /**
     * \brief Cette mthode permet de rechercher un employ avec une paire Nom/Prnom.
     *
@@ -167,15 +209,13 @@ public:
 private:
 
    /**
-    * \enum TypeEntree
-    * \brief Les tiquettes pour dfinir l'tat d'une entre dans la table.
+    * \brief Les octets de contrle pour dfinir l'tat d'une entre dans la table.
+    *
+    * Une entre occupe a pour octet de contrle le fragment de hachage de sa cl (0  127);
+    * les deux autres valeurs ont le bit de poids fort  1 et ne peuvent pas tre confondues avec un fragment.
     */
-   enum TypeEntree
-   {
-      ACTIVE,     /*!< L'entre est occupe. */
-      VIDE,       /*!< L'entre est vide. */
-      SUPPRIMEE   /*!< L'entre a t supprime. */
-   };
+   static constexpr unsigned char VIDE = 0x80;      /*!< L'entre est vide. */
+   static constexpr unsigned char SUPPRIMEE = 0xFE; /*!< L'entre a t supprime. */
 
    /**
     * \class Entree
@@ -191,14 +231,88 @@ private:
       std::string fax;        /*!< Le numro de fax de la personne. */
       std::string courriel;   /*!< L'adresse courriel de la personne. */
 
+      std::string clefTel;        /*!< La cl de hachage du tlphone: ses chiffres et ses lettres. */
+      std::string clefNomPrenom;  /*!< La cl de hachage du Nom/Prnom: ses chiffres et ses lettres. */
+
+      bool supprimee;             /*!< VRAI si l'entre a t supprime; le compactage la retire. */
+
       /**
        * \brief Constructeur avec arguments pour initialiser les membres de la classe.
        *
+       * Les cls de hachage sont cres une seule fois, ici; les tables de dispersions ne gardent
+       * que la position de l'entre et y comparent les cls.
+       *
        * \post Une instance de la classe Entree est initialise.
        */
       Entree(const std::string & n, const std::string & p, const std::string & t,
              const std::string & f, const std::string & c) :
-             nom(n), prenom(p), tel(t), fax(f), courriel(c) {}
+             nom(n), prenom(p), tel(t), fax(f), courriel(c),
+             clefTel(_creerClef(Clef(t))), clefNomPrenom(_creerClef(Clef(n, p))), supprimee(false) {}
+   };
+
+   /**
+    * \class Clef
+    *
+    * \brief Classe interne pour lire une cl de hachage sans la copier.
+    *
+    * La cl est la suite des chiffres et des lettres d'une chane (un numro de tlphone, ou
+    * "Nom, Prnom"), ou de deux chanes mises bout  bout (le nom, puis le prnom). Les autres
+    * caractres sont sauts au fil de la lecture. Une Clef se copie sans frais: une copie faite
+    * avant la lecture relit la cl depuis le dbut.
+    */
+   class Clef
+   {
+   public:
+      /**
+       * \brief Constructeur pour une cl lue dans une seule chane.
+       *
+       * \post La chane doit vivre aussi longtemps que la cl.
+       */
+      explicit Clef(const std::string & c) :
+             courant(c.data()), finCourant(c.data() + c.size()), suite(0), finSuite(0) {}
+
+      /**
+       * \brief Constructeur pour une cl Nom/Prnom lue dans deux chanes.
+       *
+       * \post Les chanes doivent vivre aussi longtemps que la cl.
+       */
+      Clef(const std::string & nom, const std::string & prenom) :
+             courant(nom.data()), finCourant(nom.data() + nom.size()),
+             suite(prenom.data()), finSuite(prenom.data() + prenom.size()) {}
+
+      /**
+       * \brief Lit le prochain chiffre ou la prochaine lettre de la cl.
+       *
+       * \post FAUX est retourn si la cl est termine.
+       */
+      bool lire(char & c)
+      {
+         for (;;)
+         {
+            while (courant != finCourant)
+            {
+               c = *courant++;
+
+               // un chiffre ou une lettre non accentue, comme isdigit() et isalpha() dans la locale "C"
+               if ((c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z'))
+                  return true;
+            }
+
+            if (suite == finSuite)
+               return false;
+
+            // on passe  la deuxime chane
+            courant = suite;
+            finCourant = finSuite;
+            suite = finSuite = 0;
+         }
+      }
+
+   private:
+      const char * courant;     /*!< Le prochain caractre  lire. */
+      const char * finCourant;  /*!< La fin de la chane en cours de lecture. */
+      const char * suite;       /*!< Le dbut de la deuxime chane, s'il y en a une. */
+      const char * finSuite;    /*!< La fin de la deuxime chane. */
    };
 
    /**
@@ -209,57 +323,117 @@ private:
    class HashEntree
    {
    public:
-      std::string clef; /*!< La cl de hachage. */
-      int position;     /*!< La position de tabEntree associe  la cl. */
-      TypeEntree info;  /*!< tiquette de l'tat de l'entre (active, vide ou supprime). */
+      std::uint64_t hachage;  /*!< Le hachage de la cl, calcul une seule fois. */
+      int position;           /*!< La position de tabEntree associe  la cl; la cl y est garde. */
 
       /**
        * \brief Constructeur par dfaut pour permettre d'initialiser la table  une certaine grandeur.
        *
+       * Les membres ne sont pas initialiss: seule une case dont l'octet de contrle dit qu'elle
+       * est occupe est lue. Une grande table neuve n'est ainsi pas parcourue  sa cration.
+       *
        * \post Une instance de la classe HashEntree est initialise.
        */
-      HashEntree() : position(0), info(VIDE) {}
+      HashEntree() {}
 
       /**
        * \brief Constructeur avec arguments pour initialiser les membres de la classe.
        *
        * \post Une instance de la classe HashEntree est initialise.
        */
-      HashEntree(const std::string & c, const int & p, TypeEntree i = VIDE) :
-                 clef(c), position(p), info(i) {}
+      HashEntree(std::uint64_t h, const int & p) :
+                 hachage(h), position(p) {}
    };
 
 
    // Attributs de la classe Bottin
 
-   std::vector<Entree> tabEntree;         /*!< Le tableau des entres. */
+   std::deque<Entree> tabEntree;          /*!< Le tableau des entres; il grandit sans recopier les entres. */
 
    std::vector<HashEntree> tabTelephone;  /*!< Table de dispersion sur la cl tlphone. */
    std::vector<HashEntree> tabNomPrenom;  /*!< Table de dispersion sur la cl Nom/Prnom. */
 
+   std::vector<unsigned char> ctrlTelephone;  /*!< Les octets de contrle de tabTelephone. */
+   std::vector<unsigned char> ctrlNomPrenom;  /*!< Les octets de contrle de tabNomPrenom. */
+
+   std::vector<HashEntree> ancienneTelephone;      /*!< L'ancienne tabTelephone, vide hors migration. */
+   std::vector<HashEntree> ancienneNomPrenom;      /*!< L'ancienne tabNomPrenom, vide hors migration. */
+   std::vector<unsigned char> ancienCtrlTelephone; /*!< Les octets de contrle de ancienneTelephone. */
+   std::vector<unsigned char> ancienCtrlNomPrenom; /*!< Les octets de contrle de ancienneNomPrenom. */
+
+   unsigned int migrationTel;  /*!< La prochaine case de ancienneTelephone  migrer. */
+   unsigned int migrationNom;  /*!< La prochaine case de ancienneNomPrenom  migrer. */
+
    int collisionsTel;       /*!< Le nombre de collisions  l'insertion dans tabTelephone. */
    int collisionsNom;       /*!< Le nombre de collisions  l'insertion dans tabNomPrenom. */
 
-   unsigned int tailleTel;  /*!< Le nombre d'lments courant dans tabTelephone. */
-   unsigned int tailleNom;  /*!< Le nombre d'lments courant dans tabNomPrenom. */
+   unsigned int tailleTel;  /*!< Le nombre d'lments courant dans tabTelephone, cases supprimes comprises. */
+   unsigned int tailleNom;  /*!< Le nombre d'lments courant dans tabNomPrenom, cases supprimes comprises. */
+
+   unsigned int entreesSupprimees;  /*!< Le nombre d'entres supprimes encore dans tabEntree. */
 
    static const int TAUX_MAX = 50;  /*!< 50% : taux de remplissage maximum dans la table. */
 
+   /**
+    * \brief Le nombre de cases de l'ancienne table migres  chaque insertion.
+    *
+    * La nouvelle table a deux fois plus de cases que l'ancienne: elle atteint TAUX_MAX aprs au
+    * moins (taille de l'ancienne) / 2 insertions, et 2 cases par insertion suffiraient  finir la
+    * migration avant. Avec 8, elle se termine bien plus tt et libre l'ancienne table.
+    */
+   static const int PAS_MIGRATION = 8;
+
+   /**
+    * \brief 25% : taux maximum d'entres supprimes dans tabEntree avant un compactage.
+    *
+    * Chaque entre supprime laisse une case supprime dans chaque table. Le compactage cote
+    * autant que le nombre d'entres, mais n'arrive qu'aprs un nombre de suppressions du mme ordre.
+    */
+   static const int TAUX_SUPPRIMEES_MAX = 25;
+
 
    // Mthodes prives
 
    /**
     * \brief Cette mthode permet de crer une cl en supprimant les caractres qui ne sont pas
     *        des chiffres ou des lettres.
+    *
+    * Elle ne sert qu' la construction d'une Entree, pour y garder ses cls.
+    */
+   static std::string _creerClef(Clef c);
+
+   /**
+    * \brief Cette mthode dit si une cl est un numro de tlphone (elle commence par un chiffre).
     */
-   std::string _creerClef(const std::string & c);
+   static bool _estTelephone(Clef clef);
+
+   /**
+    * \brief Cette mthode donne une cl garde dans une entre de tabEntree.
+    *
+    * \post La cl est celle du tlphone si telephone est VRAI, celle du Nom/Prnom sinon.
+    */
+   const std::string & _clefGardee(bool telephone, int position) const;
+
+   /**
+    * \brief Cette mthode compare une cl garde dans tabEntree avec une cl lue au vol.
+    *
+    * \post VRAI est retourn si les deux cls sont identiques, FAUX sinon.
+    */
+   static bool _memeClef(const std::string & clefGardee, Clef clef);
+
+   /**
+    * \brief Cette mthode recherche une cl sans modifier le nombre de collisions.
+    *
+    * \post VRAI est retourn si la cl est prsente, FAUX sinon.
+    */
+   bool _contient(const Clef & clef);
 
    /**
     * \brief Cette mthode vrifie si une position est active (occupe).
     *
     * \post VRAI est retourn si la position est active, FAUX sinon.
     */
-   bool _estActive(const std::string & clef, int positionCourante) const;
+   bool _estActive(const Clef & clef, int positionCourante) const;
 
    /**
     * \brief Cette mthode insre une paire (cl, valeur) dans la table de dispersion.
@@ -268,6 +442,7 @@ private:
     * La mthode fait appel  la mthode prive _trouverPosition() pour localiser
     * une place vacante dans la table de dispersion.
     *
+    * Chaque insertion migre d'abord PAS_MIGRATION cases de l'ancienne table, s'il y en a une.
     * Si aprs une insertion le taux de remplissage atteint le maximum, on double la taille
     * de la table de dispersion en appelant la mthode prive _rehash().
     *
@@ -277,23 +452,97 @@ private:
     *
     * \exception logic_error : si la cl est dj prsente dans la table.
     */
-   void _inserer(const std::string & c, const int & pos);
+   void _inserer(const Clef & clef, const int & pos);
+
+   /**
+    * \brief Cette mthode copie une entre de l'ancienne table dans une case libre de la table courante.
+    *
+    * Elle sert  la migration: une cl n'est jamais dans les deux tables et son hachage est dj
+    * connu; on ne la compare donc pas et on ne la hache pas de nouveau.
+    *
+    * \post La position retourne est celle de la table courante.
+    */
+   int _placer(bool telephone, const HashEntree & entree);
+
+   /**
+    * \brief Cette mthode migre des cases de l'ancienne table vers la table courante.
+    *
+    * \post Quand toutes les cases sont migres, l'ancienne table est libre.
+    */
+   void _migrer(bool telephone, unsigned int nbCases);
+
+   /**
+    * \brief Cette mthode sonde une table de dispersion pour une cl.
+    *
+    * \post Si la cl n'est pas active, la position retourne est la premire case supprime
+    *       rencontre, ou sinon la case vide qui a arrt le sondage.
+    */
+   int _sonder(const std::vector<HashEntree> & table, const std::vector<unsigned char> & ctrl,
+               bool telephone, const Clef & clef, std::uint64_t hachage, int & collisions) const;
 
    /**
     * \brief Cette mthode permet de trouver la position d'une cl dans la table de dispersion.
     *
     * Cette mthode est utilise par les mthodes qui font l'insertion, la recherche et
-    * la suppression.
+    * la suppression. Si la cl n'est pas active dans la table, la position retourne est la
+    * premire case supprime rencontre, ou sinon la case vide qui a arrt le sondage.
+    *
+    * Pendant une migration, une cl trouve dans l'ancienne table est d'abord dplace dans la
+    * table courante: la position retourne est toujours celle de la table courante.
+    *
+    * Le hachage de la cl est fourni par l'appelant, qui ne le calcule qu'une fois.
     */
-   int _trouverPosition(const std::string & clef);
+   int _trouverPosition(const Clef & clef, std::uint64_t hachage);
 
    /**
-    * \brief Cette mthode permet de redimensionner la capacit des tables de dispersions.
+    * \brief Cette mthode calcule le hachage de 64 bits d'une cl.
+    *
+    * La cl est lue au vol et regroupe en blocs de 8, puis 4, puis 1 octet(s), comme dans
+    * xxHash64; sa longueur n'est connue qu' la fin et y est ajoute. Chaque bloc est
+    * multipli par de grands nombres premiers et tourn, et un mlange final fait dpendre chaque
+    * bit du rsultat de tous les caractres. Des numros de tlphone qui ne diffrent que par
+    * quelques chiffres donnent ainsi des positions sans rapport entre elles.
+    */
+   static std::uint64_t _hacher(Clef clef);
+
+   /**
+    * \brief Cette mthode extrait d'un hachage le fragment de 7 bits gard dans l'octet de contrle.
+    *
+    * Ce sont les 7 bits de poids fort; la position initiale vient surtout des bits de poids faible.
+    */
+   static unsigned char _fragment(std::uint64_t hachage);
+
+   /**
+    * \brief Cette mthode permet de redimensionner la capacit d'une table de dispersion.
     *
     * Cette mthode peut tre appele par _inserer(). Si, aprs une insertion, le taux de
-    * remplissage atteint le maximum, cette mthode augmente la taille des tables de dispersions.
+    * remplissage atteint le maximum, cette mthode met la table de ct comme ancienne table
+    * et la remplace par une table vide deux fois plus grande; les insertions suivantes migrent
+    * les entres. Une migration pas encore termine est d'abord acheve.
+    */
+   void _rehash(bool telephone);
+
+   /**
+    * \brief Cette mthode retire de tabEntree les entres supprimes et reconstruit les deux tables.
+    *
+    * Elle est appele par supprimer() quand les entres supprimes dpassent TAUX_SUPPRIMEES_MAX.
+    * Les entres qui restent gardent leur ordre; une migration en cours est termine du mme coup.
+    */
+   void _compacter();
+
+   /**
+    * \brief Cette mthode reconstruit une table de dispersion aprs le compactage de tabEntree.
+    *
+    * Les cls actives de la table et de l'ancienne table sont places, avec leur hachage gard et
+    * leur nouvelle position, dans une table neuve sans cases supprimes.
+    */
+   void _reconstruire(bool telephone, const std::vector<int> & nouvellePosition);
+
+   /**
+    * \brief Cette mthode compte les cases d'une table de dispersion selon leur tat.
     */
-   void _rehash();
+   static Occupation _occupation(const std::vector<unsigned char> & ctrl,
+                                 const std::vector<unsigned char> & ancienCtrl);
 
    /**
     * \brief Cette mthode permet de vrifier si un nombre est premier.
@@ -0,0 +1,229 @@
+/**
+ * \file TestBottin.cpp
+ * \brief Test de contrainte du Bottin contre une std::map de rfrence
+ * \author Mathieu L'cuyer, ric Guillemette
+ * \version 0.1
+ * \date juillet 2014
+ *
+ * Des oprations au hasard (ajouts, doublons, suppressions par tlphone ou par nom, recherches
+ * de cls prsentes et absentes) sont faites  la fois sur un Bottin et sur deux std::map de
+ * rfrence, l'une par tlphone, l'autre par nom. Les tables partent de Bottin(1)  Bottin(7),
+ * puis de Bottin(101): les petites grandissent par plusieurs migrations, et beaucoup d'oprations
+ * tombent pendant l'une d'elles. Toutes les 100 oprations, chaque cl de la rfrence est
+ * cherche par ses deux cls.
+ *
+ * Aprs chaque opration, l'occupation de chaque table doit compter chaque employ une fois:
+ * actives + aMigrer == taille de la rfrence. Une suppression qui ne laisse aucune case
+ * supprime dans les tables a dclench un compactage (_compacter() puis _reconstruire()):
+ * il doit en survenir pendant une migration et hors migration, et l'ancienne table doit alors
+ * tre vide.
+ *
+ *    g++ -std=c++17 -O2 -I. TestBottin.cpp Bottin.cpp
+ */
+
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "Bottin.h"
+
+using namespace std;
+using namespace TP2P2;
+
+/**
+ * \fn string clef(const string & texte)
+ * \brief La cl d'une chane: ses chiffres et ses lettres, comme dans le Bottin.
+ */
+static string clef(const string & texte)
+{
+   string c;
+   for (size_t i = 0; i < texte.size(); i++)
+      if (isalnum((unsigned char)texte[i]))
+         c += texte[i];
+   return c;
+}
+
+/**
+ * \fn void verifier(bool condition, const string & message)
+ * \brief Lance une logic_error si la condition est fausse.
+ */
+static void verifier(bool condition, const string & message)
+{
+   if (!condition)
+      throw logic_error(message);
+}
+
+/**
+ * \fn void verifierEmploye(const Employe & e, const Employe & attendu, const string & c)
+ * \brief Compare un employ trouv  celui de la rfrence.
+ */
+static void verifierEmploye(const Employe & e, const Employe & attendu, const string & c)
+{
+   verifier(e.nom == attendu.nom && e.prenom == attendu.prenom && e.tel == attendu.tel &&
+            e.fax == attendu.fax && e.courriel == attendu.courriel, "employe different pour " + c);
+}
+
+/**
+ * \fn bool chercher(Bottin & bottin, const string & c, bool telephone, const map<string, Employe> & reference)
+ * \brief Cherche une cl avec contient() et trouverAvec*(), et compare avec la rfrence.
+ *
+ * \return VRAI si la cl est prsente.
+ */
+static bool chercher(Bottin & bottin, const string & c, bool telephone, const map<string, Employe> & reference)
+{
+   map<string, Employe>::const_iterator trouve = reference.find(clef(c));
+   bool present = trouve != reference.end();
+   verifier(bottin.contient(c) == present, "contient() differe de la reference pour " + c);
+
+   int nbCollisions = 0;
+   bool leve = false;
+   try
+   {
+      Employe e = telephone ? bottin.trouverAvecTelephone(c, nbCollisions) : bottin.trouverAvecNomPrenom(c, nbCollisions);
+      if (present)
+         verifierEmploye(e, trouve->second, c);
+   }
+   catch (logic_error &)
+   {
+      leve = true;
+   }
+   verifier(leve != present, "trouverAvec*() differe de la reference pour " + c);
+   return present;
+}
+
+/**
+ * \fn void verifierOccupation(const Occupation & o, size_t nbEmployes, const string & table)
+ * \brief Chaque employ doit tre compt une fois: dans la table, ou dans l'ancienne s'il reste  migrer.
+ */
+static void verifierOccupation(const Occupation & o, size_t nbEmployes, const string & table)
+{
+   verifier(o.actives + o.aMigrer == nbEmployes, "occupation de " + table + " : " + to_string(o.actives) + " actives + " +
+            to_string(o.aMigrer) + " a migrer pour " + to_string(nbEmployes) + " employes");
+}
+
+/**
+ * \fn int main()
+ * \brief Fait les oprations pour chaque taille de dpart et affiche la premire incohrence.
+ *
+ * \return 0 si le Bottin est rest conforme  la rfrence, 1 sinon.
+ */
+int main()
+{
+   static const char * noms[] = { "Tremblay", "Gagnon", "Roy", "Cote", "Bouchard", "Gauthier", "Morin",
+                                  "Lavoie", "Fortin", "Gagne", "Ouellet", "Pelletier", "Belanger", "Levesque" };
+   static const char * prenoms[] = { "Jean", "Marie", "Luc", "Anne", "Paul", "Julie", "Marc", "Sophie" };
+   const int TAILLES[] = { 1, 2, 3, 4, 5, 6, 7, 101 };
+   const int NB_OPERATIONS = 20000;
+
+   mt19937 generateur(2014);
+   long nbOperations = 0, pendantMigration = 0, nbSuppressions = 0, nbAbsentes = 0;
+   long compactagesMigration = 0, compactagesHorsMigration = 0;
+
+   try
+   {
+      for (int t = 0; t < 8; t++)
+      {
+         Bottin bottin(TAILLES[t]);
+         map<string, Employe> parTel, parNom;
+
+         for (int operation = 1; operation <= NB_OPERATIONS; operation++)
+         {
+            // Peu de noms et de numros diffrents, pour que les doublons et les suppressions tombent souvent juste
+            Employe e;
+            e.nom = string(noms[generateur() % 14]) + "-" + noms[generateur() % 14];
+            e.prenom = prenoms[generateur() % 8];
+            char numero[20];
+            snprintf(numero, sizeof(numero), "(%03u) 555-%04u", unsigned(generateur() % 3 + 418), unsigned(generateur() % 400));
+            e.tel = numero;
+            e.fax = e.tel;
+            e.courriel = e.prenom + "@" + e.nom + ".ca";
+            string nomPrenom = e.nom + ", " + e.prenom;
+            unsigned int choix = generateur() % 100;
+
+            Occupation tel = bottin.getOccupationTel(), nom = bottin.getOccupationNom();
+            bool migration = tel.aMigrer != 0 || nom.aMigrer != 0;
+            if (migration)
+               pendantMigration++;
+
+            if (choix < 45)
+            {
+               bool doublon = parTel.count(clef(e.tel)) != 0 || parNom.count(clef(nomPrenom)) != 0;
+               bool leve = false;
+               try { bottin.ajouter(e.nom, e.prenom, e.tel, e.fax, e.courriel); }
+               catch (logic_error &) { leve = true; }
+               verifier(leve == doublon, "ajouter() differe de la reference pour " + nomPrenom + " " + e.tel);
+               if (!doublon)
+               {
+                  parTel[clef(e.tel)] = e;
+                  parNom[clef(nomPrenom)] = e;
+               }
+            }
+            else if (choix < 75)
+            {
+               // par tlphone ou par nom, prsent ou non
+               bool telephone = choix < 60;
+               const string c = telephone ? e.tel : nomPrenom;
+               map<string, Employe> & reference = telephone ? parTel : parNom;
+               map<string, Employe>::iterator trouve = reference.find(clef(c));
+               bool present = trouve != reference.end();
+               bool leve = false;
+               try { bottin.supprimer(c); }
+               catch (logic_error &) { leve = true; }
+               verifier(leve != present, "supprimer() differe de la reference pour " + c);
+               if (present)
+               {
+                  Employe supprime = trouve->second;
+                  parTel.erase(clef(supprime.tel));
+                  parNom.erase(clef(supprime.nom + supprime.prenom));
+                  nbSuppressions++;
+
+                  // sans compactage, la suppression laisse une case supprime dans chaque table
+                  Occupation apresTel = bottin.getOccupationTel(), apresNom = bottin.getOccupationNom();
+                  if (apresTel.supprimees == 0 && apresNom.supprimees == 0)
+                  {
+                     verifier(apresTel.aMigrer == 0 && apresNom.aMigrer == 0, "ancienne table non videe par le compactage");
+                     if (migration)
+                        compactagesMigration++;
+                     else
+                        compactagesHorsMigration++;
+                  }
+               }
+            }
+            else
+            {
+               bool telephone = choix < 88;
+               if (!chercher(bottin, telephone ? e.tel : nomPrenom, telephone, telephone ? parTel : parNom))
+                  nbAbsentes++;
+            }
+            nbOperations++;
+            verifierOccupation(bottin.getOccupationTel(), parTel.size(), "tabTelephone");
+            verifierOccupation(bottin.getOccupationNom(), parNom.size(), "tabNomPrenom");
+
+            if (operation % 100 == 0)
+            {
+               for (map<string, Employe>::const_iterator i = parTel.begin(); i != parTel.end(); ++i)
+               {
+                  chercher(bottin, i->second.tel, true, parTel);
+                  chercher(bottin, i->second.nom + ", " + i->second.prenom, false, parNom);
+               }
+            }
+         }
+      }
+      verifier(pendantMigration > 0, "aucune operation pendant une migration");
+      verifier(compactagesMigration > 0 && compactagesHorsMigration > 0, "compactage jamais atteint pendant une migration et hors migration (" +
+               to_string(compactagesMigration) + ", " + to_string(compactagesHorsMigration) + ")");
+   }
+   catch (exception & e)
+   {
+      cout << "Echec apres " << nbOperations << " operations : " << e.what() << endl;
+      return 1;
+   }
+
+   cout << nbOperations << " operations (" << pendantMigration << " pendant une migration, " << nbSuppressions
+        << " suppressions, " << compactagesMigration << " compactages pendant une migration et " << compactagesHorsMigration
+        << " hors migration, " << nbAbsentes << " cles absentes cherchees), aucune erreur" << endl;
+   return 0;
+}